@@ -3,11 +3,29 @@
 #include "Command/Graph Command/GraphCommand.h"
 #include "Runtime Error/RuntimeError.h"
 #include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/GraphIOConstants.h"
+#include "Graph IO/Journal Replayer/JournalReplayer.h"
+#include "Graph IO/Checkpoint Loader/CheckpointLoader.h"
+#include "Graph IO/Content Hash/ContentHash.h"
+#include "Interrupt Guard/InterruptGuard.h"
+#include "Server/Server.h"
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <filesystem>
+#include <cstdio>
+#include <thread>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 const String Application::COMMAND_PROMPT = "$ ";
+const std::chrono::milliseconds Application::INTERRUPTION_CHECK_INTERVAL(100);
+thread_local StringCutter Application::cutter(Delimiters({ '\'', '\"' }));
+thread_local CommandArguments::Words Application::words;
 
 Application& Application::instance()
 {
@@ -17,10 +35,10 @@ Application& Application::instance()
 }
 
 Application::Application() :
-	parser("GRAPH STORE APPLICATION"),
-	commandsGroup(parser, "SUPPORTED COMMANDS"),
-	cutter(Delimiters({ '\'', '\"' })),
-	receivedExitCommand(false)
+	shouldStopOnError(false),
+	shouldCommitJournalInBatches(false),
+	consoleSession(std::cout),
+	port(0)
 {
 	addExitCommand();
 	addHelpCommand();
@@ -30,40 +48,42 @@ void Application::addExitCommand()
 {
 	addCommand("exit",
 		       "Terminates the program",
-		       [&](args::Subparser& parser)
+		       [&](CommandArguments& arguments)
 	{
-		parser.Parse();
-		receivedExitCommand = true;
-	});
+		arguments.verifyAllAreTaken();
+		Session::current().end();
+	}, Command::Access::SESSION);
 }
 
 void Application::addHelpCommand()
 {
 	addCommand("help", "Lists the supported commands",
-		       [&](args::Subparser& parser)
+		       [&](CommandArguments& arguments)
 	{
-		parser.Parse();
+		arguments.verifyAllAreTaken();
+		std::ostream& output = Session::current().getOutput();
 		
-		std::cout << "Supported commands:\n";
+		output << "Supported commands:\n";
 
 		std::for_each(commands.cbegin(),
 			          commands.cend(),
-			          [](const args::Command& c)
+			          [&output](const CommandsTable::value_type& c)
 		{
-			std::cout << '\t' << c.Name()
-					  << ": " << c.Help() << '\n';
+			output << '\t' << c.first
+					  << ": " << c.second.description << '\n';
 		});
-	});
+	}, Command::Access::SESSION);
 }
 
 void Application::addCommand(const char* name,
 							 const char* description,
-							 Function f)
+							 Function f,
+							 Command::Access access)
 {
 	verifyStringIsNotNull(name);
 	verifyStringIsNotNull(description);
 
-	commands.emplace_front(commandsGroup, name, description, f);
+	commands[name] = RegisteredCommand{ description, std::move(f), access };
 }
 
 void Application::verifyStringIsNotNull(const char* s)
@@ -76,29 +96,134 @@ void Application::verifyStringIsNotNull(const char* s)
 
 void Application::addCommand(const char* name,
 							 const char* description,
-							 Command& command)
+							 CommandOfThread getCommand)
 {
-	addCommand(name, description, [&](args::Subparser& parser)
+	addCommand(name, description, [getCommand](CommandArguments& arguments)
 	{
-		command.execute(parser);
-	});
+		getCommand().execute(arguments);
+	}, getCommand().getAccess());
+}
+
+void Application::setScript(const String& fileName)
+{
+	scriptFileName = fileName;
+}
+
+void Application::stopOnFirstError() noexcept
+{
+	shouldStopOnError = true;
 }
 
-void Application::runIn(const String& directory)
+/*
+	Lets scripts synchronise the journal with the disk once per
+	COMMANDS_PER_JOURNAL_COMMIT commands instead of after every command,
+	so a crash may lose the changes of the last commands.
+*/
+void Application::commitJournalInBatches() noexcept
+{
+	shouldCommitJournalInBatches = true;
+}
+
+void Application::listenOn(const String& socketFileName)
+{
+	this->socketFileName = socketFileName;
+}
+
+void Application::listenOnPort(std::uint16_t port)
+{
+	this->port = port;
+}
+
+bool Application::runIn(const String& directory)
 {
 	try
 	{
+		openListener();
+		openScript();
+
+		if (!isServing() && isInBatchMode())
+		{
+			useBufferedStandardStreams();
+		}
+
 		setCurrentDirectory(directory);
 		loadGraphsFrom(directory);
 	}
 	catch (std::exception& e)
 	{
 		Logger::logError(e);
-		return;
+		return false;
 	}
 
 	passLoadedGraphsToGraphCommands();
+
+	if (isServing())
+	{
+		return serve();
+	}
+	else if (isInBatchMode())
+	{
+		return runScript();
+	}
+
 	interact();
+
+	return true;
+}
+
+void Application::openListener()
+{
+	if (socketFileName.getLength() > 0)
+	{
+		auto path = std::filesystem::absolute(socketFileName.cString());
+		socketFileName = path.string().c_str();
+		listener = Socket::listenOn(socketFileName);
+	}
+	else if (port != 0)
+	{
+		listener = Socket::listenOnPort(port);
+	}
+}
+
+bool Application::isServing() const noexcept
+{
+	return listener.isOpen();
+}
+
+void Application::openScript()
+{
+	if (scriptFileName.getLength() > 0)
+	{
+		scriptBuffer.resize(SCRIPT_BUFFER_SIZE);
+		script.rdbuf()->pubsetbuf(scriptBuffer.data(), scriptBuffer.size());
+		script.open(scriptFileName.cString());
+
+		if (!script.is_open())
+		{
+			throw RuntimeError("Could not open the script: " + scriptFileName);
+		}
+	}
+}
+
+bool Application::isInBatchMode() const
+{
+	return script.is_open() || !isStandardInputATerminal();
+}
+
+bool Application::isStandardInputATerminal()
+{
+#ifdef _WIN32
+	return _isatty(_fileno(stdin)) != 0;
+#else
+	return isatty(fileno(stdin)) != 0;
+#endif
+}
+
+void Application::useBufferedStandardStreams()
+{
+	std::setvbuf(stdout, nullptr, _IOFBF, OUTPUT_BUFFER_SIZE);
+	std::ios::sync_with_stdio(false);
+	std::cin.tie(nullptr);
 }
 
 void Application::setCurrentDirectory(const String& path)
@@ -115,12 +240,81 @@ void Application::setCurrentDirectory(const String& path)
 
 void Application::loadGraphsFrom(const String& directory)
 {
-	graphs = GraphIO::loadDirectory(directory);
+	auto records = journal.open(GraphIO::JOURNAL_FILE_NAME);
+	auto firstRecordToReplay = std::size_t{ 0 };
+
+	if (!tryToRestoreCheckpoint(directory, records, firstRecordToReplay))
+	{
+		graphs = GraphIO::loadDirectory(directory);
+	}
+
+	replayJournal(records, firstRecordToReplay);
+}
+
+bool Application::tryToRestoreCheckpoint(const String& directory,
+	                                     const JournalRecords& records,
+	                                     std::size_t& firstRecordToReplay)
+{
+	if (!GraphIO::CheckpointLoader::isNewerThanTheGraphFilesIn(directory,
+		                                                       GraphIO::CHECKPOINT_FILE_NAME))
+	{
+		return false;
+	}
+
+	try
+	{
+		auto loader = GraphIO::CheckpointLoader();
+		loader.open(GraphIO::CHECKPOINT_FILE_NAME);
+		auto position = std::size_t{ 0 };
+
+		if (!loader.findRecordIn(records, position))
+		{
+			return false;
+		}
+
+		graphs = loader.load();
+		firstRecordToReplay = position + 1;
+
+		std::cout << "Restored " << graphs.getCount()
+				  << " graphs from the checkpoint.\n";
+
+		return true;
+	}
+	catch (std::exception& e)
+	{
+		Logger::logError(e);
+
+		return false;
+	}
+}
+
+void Application::replayJournal(const JournalRecords& records,
+	                            std::size_t firstRecord)
+{
+	if (firstRecord < records.size())
+	{
+		auto replayer = GraphIO::JournalReplayer(graphs);
+		auto replayedRecordsCount = replayer.replay(records, firstRecord);
+
+		std::cout << "Replayed " << replayedRecordsCount
+				  << " unsaved changes from the journal.\n";
+
+		if (replayer.getSkippedRecordsCount() > 0)
+		{
+			std::cout << "Skipped " << replayer.getSkippedRecordsCount()
+					  << " changes that could not be applied.\n";
+		}
+	}
 }
 
 void Application::passLoadedGraphsToGraphCommands()
 {
 	GraphCommand::setGraphs(graphs);
+	GraphCommand::setJournal(journal);
+	GraphCommand::setBackgroundSaver(backgroundSaver);
+	GraphCommand::setFileWatcher(fileWatcher);
+	GraphCommand::setPathIndex(pathIndex);
+	consoleSession.makeCurrent();
 }
 
 void Application::interact()
@@ -132,23 +326,492 @@ void Application::interact()
 	{
 		std::cout << COMMAND_PROMPT;
 		std::cin.getline(commandLine, COMMAND_LINE_SIZE);
+		applyGraphFileChanges();
 		invokeCommand(commandLine);
-	} while (!receivedExitCommand);
+		finishBackgroundSaveIfItIsDone();
+		commitJournal();
+		savePathIndexIfItIsDue();
+	} while (!consoleSession.hasEnded());
+
+	fileWatcher.stop();
+	waitForBackgroundSave();
+	pathIndex.saveChanges(graphs);
+}
+
+bool Application::runScript()
+{
+	bool hasSucceeded = script.is_open() ?
+		                runScriptFrom(script) :
+		                runScriptFrom(std::cin);
+
+	fileWatcher.stop();
+	waitForBackgroundSave();
+	pathIndex.saveChanges(graphs);
+	std::cout.flush();
+
+	return hasSucceeded;
+}
+
+bool Application::runScriptFrom(std::istream& input)
+{
+	auto line = std::string{};
+	auto lineNumber = std::size_t{ 0 };
+	auto commandsCount = std::size_t{ 0 };
+	bool hasSucceeded = true;
+
+	while (!consoleSession.hasEnded() && std::getline(input, line))
+	{
+		++lineNumber;
+
+		if (isBlankOrComment(line))
+		{
+			continue;
+		}
+
+		applyGraphFileChanges();
+
+		if (!invokeCommand(line.data(), lineNumber))
+		{
+			hasSucceeded = false;
+
+			if (shouldStopOnError)
+			{
+				break;
+			}
+		}
+
+		finishBackgroundSaveIfItIsDone();
+		savePathIndexIfItIsDue();
+
+		if (!shouldCommitJournalInBatches
+			|| ++commandsCount % COMMANDS_PER_JOURNAL_COMMIT == 0)
+		{
+			commitJournal();
+		}
+	}
+
+	commitJournal();
+
+	return hasSucceeded;
+}
+
+bool Application::serve()
+{
+	auto server = Server([this](Session& session, char* commandLine)
+	{
+		executeCommandOf(session, commandLine);
+	});
+
+	server.start(std::move(listener));
+
+	if (socketFileName.getLength() > 0)
+	{
+		std::cout << "Serving on " << socketFileName;
+	}
+	else
+	{
+		std::cout << "Serving on port " << port;
+	}
+
+	std::cout << ". Press Ctrl+C to stop.\n" << std::flush;
+
+	maintainStoreUntilInterrupted();
+	server.stop();
+	removeSocketFile();
+	fileWatcher.stop();
+	waitForBackgroundSave();
+	commitJournal();
+	pathIndex.saveChanges(graphs);
+
+	return true;
+}
+
+void Application::removeSocketFile() const
+{
+	if (socketFileName.getLength() > 0)
+	{
+		auto error = std::error_code{};
+		std::filesystem::remove(socketFileName.cString(), error);
+	}
+}
+
+/*
+	While the server runs, the journal is committed and the path index is
+	saved along with the commands that are being executed. The changes of
+	graph files are applied, the finished background saves are completed
+	and the journal is compacted whenever no command is being executed, or
+	by waiting for the commands to finish once that has not happened
+	MAX_FAILED_MAINTENANCE_ATTEMPTS times in a row.
+*/
+void Application::maintainStoreUntilInterrupted()
+{
+	auto guard = InterruptGuard();
+	auto failedAttempts = std::size_t{ 0 };
+
+	while (!guard.getInterruptionFlag())
+	{
+		std::this_thread::sleep_for(INTERRUPTION_CHECK_INTERVAL);
+
+		{
+			auto lock = std::shared_lock<std::shared_mutex>(storeMutex);
+
+			commitJournalRecords();
+			savePathIndexIfItIsDue();
+		}
+
+		auto lock = std::unique_lock<std::shared_mutex>(storeMutex,
+			                                            std::defer_lock);
+
+		if (failedAttempts < MAX_FAILED_MAINTENANCE_ATTEMPTS)
+		{
+			lock.try_lock();
+		}
+		else
+		{
+			lock.lock();
+		}
+
+		if (lock.owns_lock())
+		{
+			failedAttempts = 0;
+			applyGraphFileChanges();
+			finishBackgroundSaveIfItIsDone();
+			commitJournal();
+		}
+		else
+		{
+			++failedAttempts;
+		}
+	}
+}
+
+/*
+	Executes a command line received by the server. Commands that touch
+	single graphs are executed along with each other, while the rest of
+	the commands that touch the store are executed one at a time.
+*/
+void Application::executeCommandOf(Session& session, char* commandLine)
+{
+	session.makeCurrent();
+	const RegisteredCommand* command = findCommandIn(commandLine);
+
+	if (command == nullptr)
+	{
+		return;
+	}
+
+	switch (command->access)
+	{
+	case Command::Access::SESSION:
+		execute(*command);
+		break;
+	case Command::Access::GRAPHS:
+		executeAlongWithOthers(*command);
+		break;
+	default:
+		executeAlone(*command);
+	}
+}
+
+void Application::executeAlongWithOthers(const RegisteredCommand& command)
+{
+	auto lock = std::shared_lock<std::shared_mutex>(storeMutex);
+	auto error = std::exception_ptr{};
+
+	try
+	{
+		execute(command);
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+
+	commitJournalRecords();
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+void Application::executeAlone(const RegisteredCommand& command)
+{
+	auto lock = std::unique_lock<std::shared_mutex>(storeMutex);
+	auto error = std::exception_ptr{};
+
+	applyGraphFileChanges();
+
+	try
+	{
+		execute(command);
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+
+	finishBackgroundSaveIfItIsDone();
+	commitJournal();
+	savePathIndexIfItIsDue();
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+bool Application::isBlankOrComment(const std::string& line)
+{
+	auto start = line.find_first_not_of(" \t\r");
+
+	return start == std::string::npos || line[start] == '#';
+}
+
+void Application::applyGraphFileChanges()
+{
+	if (!fileWatcher.isWatching() || backgroundSaver.isInProgress())
+	{
+		return;
+	}
+
+	for (FileChange& change : fileWatcher.takeChanges())
+	{
+		try
+		{
+			applyGraphFileChange(change);
+		}
+		catch (std::exception& e)
+		{
+			Logger::logError(e);
+		}
+	}
+}
+
+void Application::applyGraphFileChange(FileChange& change)
+{
+	switch (change.type)
+	{
+	case GraphIO::GraphFileWatcher::ChangeType::UPDATED:
+		reloadGraph(change);
+		break;
+	case GraphIO::GraphFileWatcher::ChangeType::REMOVED:
+		removeGraph(change);
+		break;
+	default:
+		std::cerr << "Could not reload " << change.fileName
+				  << ": " << change.errorMessage << '\n';
+	}
+}
+
+void Application::reloadGraph(FileChange& change)
+{
+	const String id = change.graphID;
+
+	if (!graphs.contains(id))
+	{
+		graphs.add(std::move(change.graph));
+		graphs.markAsSaved(id);
+		std::cout << "Loaded " << id << " from " << change.fileName << ".\n";
+	}
+	else if (graphs.isModified(id))
+	{
+		std::cout << "The file of " << id << " changed, but " << id
+				  << " has unsaved changes and was not reloaded.\n";
+	}
+	else if (!graphs.isLoaded(id)
+		     || GraphIO::computeContentHashOf(graphs[id]) != change.contentHash)
+	{
+		graphs.replace(std::move(change.graph));
+		graphs.markAsSaved(id);
+		std::cout << "Reloaded " << id << " from " << change.fileName << ".\n";
+	}
+}
+
+void Application::removeGraph(const FileChange& change)
+{
+	const String& id = change.graphID;
+
+	if (!graphs.contains(id) || GraphIO::hasFileFor(id))
+	{
+		return;
+	}
+
+	if (graphs.isModified(id))
+	{
+		std::cout << "The file of " << id << " was removed, but " << id
+				  << " has unsaved changes and was kept.\n";
+	}
+	else
+	{
+		graphs.remove(id);
+		std::cout << "Removed " << id << " because "
+				  << change.fileName << " was removed.\n";
+	}
 }
 
 void Application::invokeCommand(char* commandLine)
+{
+	try
+	{
+		executeCommand(commandLine);
+	}
+	catch (std::exception& e)
+	{
+		Logger::logError(e);
+	}
+}
+
+bool Application::invokeCommand(char* commandLine, std::size_t lineNumber)
+{
+	try
+	{
+		executeCommand(commandLine);
+
+		return true;
+	}
+	catch (std::exception& e)
+	{
+		std::cerr << "Line " << lineNumber << ": ";
+		Logger::logError(e);
+
+		return false;
+	}
+}
+
+void Application::executeCommand(char* commandLine)
+{
+	const RegisteredCommand* command = findCommandIn(commandLine);
+
+	if (command != nullptr)
+	{
+		execute(*command);
+	}
+}
+
+/*
+	Cuts the command line to words and returns the command named by the
+	first one, leaving only its arguments in words. Returns nullptr for
+	blank lines.
+*/
+const Application::RegisteredCommand*
+Application::findCommandIn(char* commandLine)
 {
 	assert(commandLine != nullptr);
 
+	cutter.cutToWords(commandLine, words);
+
+	if (words.empty())
+	{
+		return nullptr;
+	}
+
+	auto command = commands.find(words.front());
+
+	if (command == commands.end())
+	{
+		throw RuntimeError("Unknown command: " + String(words.front().data()));
+	}
+
+	words.erase(words.begin());
+
+	return &command->second;
+}
+
+void Application::execute(const RegisteredCommand& command)
+{
+	auto arguments = CommandArguments(words);
+	command.function(arguments);
+}
+
+void Application::finishBackgroundSaveIfItIsDone()
+{
+	try
+	{
+		if (backgroundSaver.hasFinishedSaving())
+		{
+			backgroundSaver.finish(graphs, journal);
+		}
+	}
+	catch (std::exception& e)
+	{
+		Logger::logError(e);
+	}
+}
+
+void Application::waitForBackgroundSave()
+{
+	try
+	{
+		if (backgroundSaver.isInProgress())
+		{
+			backgroundSaver.finish(graphs, journal);
+		}
+	}
+	catch (std::exception& e)
+	{
+		Logger::logError(e);
+	}
+}
+
+void Application::commitJournal()
+{
 	try
 	{
-		ArgumentsList arguments =
-			cutter.cutToWords(commandLine);
+		journal.commit();
 
-		parser.ParseArgs(arguments);
+		if (journal.getSize() > MAX_JOURNAL_SIZE
+			&& !backgroundSaver.isInProgress())
+		{
+			compactJournal();
+		}
 	}
 	catch (std::exception& e)
 	{
 		Logger::logError(e);
 	}
 }
+
+/*
+	Commits the records of commands that are executed along with other
+	ones. The journal is compacted only by commands executed alone.
+*/
+void Application::commitJournalRecords()
+{
+	try
+	{
+		journal.commit();
+	}
+	catch (std::exception& e)
+	{
+		Logger::logError(e);
+	}
+}
+
+void Application::compactJournal()
+{
+	graphs.forEachID([this](const String& id)
+	{
+		if (graphs.isModified(id))
+		{
+			GraphIO::save(graphs[id], GraphIO::getFormatOfFileFor(id));
+			graphs.markAsSaved(id);
+		}
+	});
+
+	journal.clear();
+}
+
+
+/*
+	The paths found by searches are written to the path index in batches,
+	together with the rest of the changes when the program exits and when
+	the graphs are saved.
+*/
+void Application::savePathIndexIfItIsDue()
+{
+	if (pathIndex.getChangesCount() >= CHANGES_PER_PATH_INDEX_SAVE)
+	{
+		pathIndex.saveChanges(graphs);
+	}
+}
\ No newline at end of file
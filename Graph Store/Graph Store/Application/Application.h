@@ -1,31 +1,61 @@
 #ifndef __APPLICATION_HEADER_INCLUDED__
 #define __APPLICATION_HEADER_INCLUDED__
 
-#include "../../../../args-master/args-master/args.hxx"
 #include "Graph Collection/GraphCollection.h"
+#include "Graph IO/Journal/Journal.h"
+#include "Graph IO/Background Saver/BackgroundSaver.h"
+#include "Graph IO/Graph File Watcher/GraphFileWatcher.h"
+#include "Graph IO/Path Index/PathIndex.h"
 #include "String Cutter/StringCutter.h"
-#include <forward_list>
-
-class Command;
+#include "Command/Command Arguments/CommandArguments.h"
+#include "Command/Abstract class/Command.h"
+#include "Session/Session.h"
+#include "Socket/Socket.h"
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
 
 class Application
 {
-	using Function = std::function<void(args::Subparser&)>;
-	using ArgumentsList = std::vector<std::string>;
+	using Function = std::function<void(CommandArguments&)>;
+	using CommandOfThread = Command& (*)();
+
+	struct RegisteredCommand
+	{
+		const char* description;
+		Function function;
+		Command::Access access;
+	};
+
+	using CommandsTable = std::map<std::string_view, RegisteredCommand>;
 	using Delimiters = std::initializer_list<char>;
+	using JournalRecords = std::vector<GraphIO::Journal::Record>;
+	using FileChange = GraphIO::GraphFileWatcher::Change;
 
 public:
 	static Application& instance();
 
 public:
-	void runIn(const String& directory);
+	bool runIn(const String& directory);
+	void setScript(const String& fileName);
+	void stopOnFirstError() noexcept;
+	void commitJournalInBatches() noexcept;
+	void listenOn(const String& socketFileName);
+	void listenOnPort(std::uint16_t port);
 	void addCommand(const char* name,
 		            const char* description,
-		            Command& command);
+		            CommandOfThread getCommand);
 
 private:
 	static void verifyStringIsNotNull(const char* s);
 	static void setCurrentDirectory(const String& path);
+	static bool isStandardInputATerminal();
+	static void useBufferedStandardStreams();
+	static bool isBlankOrComment(const std::string& line);
 
 private:
 	Application();
@@ -34,25 +64,75 @@ private:
 	~Application() = default;
 
 	void loadGraphsFrom(const String& directory);
+	bool tryToRestoreCheckpoint(const String& directory,
+		                        const JournalRecords& records,
+		                        std::size_t& firstRecordToReplay);
+	void replayJournal(const JournalRecords& records, std::size_t firstRecord);
 	void passLoadedGraphsToGraphCommands();
+	void openListener();
+	void openScript();
+	bool isServing() const noexcept;
+	bool isInBatchMode() const;
+	bool serve();
+	void maintainStoreUntilInterrupted();
+	void removeSocketFile() const;
+	void executeCommandOf(Session& session, char* commandLine);
+	void executeAlongWithOthers(const RegisteredCommand& command);
+	void executeAlone(const RegisteredCommand& command);
 	void interact();
+	bool runScript();
+	bool runScriptFrom(std::istream& input);
+	void applyGraphFileChanges();
+	void applyGraphFileChange(FileChange& change);
+	void reloadGraph(FileChange& change);
+	void removeGraph(const FileChange& change);
 	void invokeCommand(char* commandLine);
+	bool invokeCommand(char* commandLine, std::size_t lineNumber);
+	void executeCommand(char* commandLine);
+	const RegisteredCommand* findCommandIn(char* commandLine);
+	void execute(const RegisteredCommand& command);
+	void finishBackgroundSaveIfItIsDone();
+	void waitForBackgroundSave();
+	void commitJournal();
+	void commitJournalRecords();
+	void compactJournal();
+	void savePathIndexIfItIsDue();
 	void addExitCommand();
 	void addHelpCommand();
 	void addCommand(const char* name,
 		            const char* description,
-		            Function function);
+		            Function function,
+		            Command::Access access);
 
 private:
 	static const String COMMAND_PROMPT;
+	static const std::size_t MAX_JOURNAL_SIZE = 4 * 1024 * 1024;
+	static const std::size_t SCRIPT_BUFFER_SIZE = 1024 * 1024;
+	static const std::size_t OUTPUT_BUFFER_SIZE = 64 * 1024;
+	static const std::size_t COMMANDS_PER_JOURNAL_COMMIT = 1000;
+	static const std::size_t CHANGES_PER_PATH_INDEX_SAVE = 64;
+	static const std::size_t MAX_FAILED_MAINTENANCE_ATTEMPTS = 10;
+	static const std::chrono::milliseconds INTERRUPTION_CHECK_INTERVAL;
+	static thread_local StringCutter cutter;
+	static thread_local CommandArguments::Words words;
 
 private:
-	args::ArgumentParser parser;
-	args::Group commandsGroup;
-	std::forward_list<args::Command> commands;
-	StringCutter cutter;
-	bool receivedExitCommand;
+	CommandsTable commands;
+	bool shouldStopOnError;
+	bool shouldCommitJournalInBatches;
+	Session consoleSession;
+	String socketFileName;
+	std::uint16_t port;
+	Socket listener;
+	std::shared_mutex storeMutex;
+	String scriptFileName;
+	std::vector<char> scriptBuffer;
+	std::ifstream script;
 	GraphCollection graphs;
+	GraphIO::Journal journal;
+	GraphIO::BackgroundSaver backgroundSaver;
+	GraphIO::GraphFileWatcher fileWatcher;
+	GraphIO::PathIndex pathIndex;
 };
 
 #endif //__APPLICATION_HEADER_INCLUDED__
\ No newline at end of file
@@ -1,33 +1,17 @@
 #include "Command.h"
-#include "Command/Exceptions/MissingArgumentException.h"
-#include "String/String.h"
 
-void Command::StringReader::operator()(const std::string& name,
-									   const std::string& value,
-									   String& destination) const
+void Command::execute(CommandArguments& arguments)
 {
-	destination = value.c_str();
-}
-
-void Command::execute(args::Subparser& parser)
-{
-	parseArguments(parser);
+	parseArguments(arguments);
+	arguments.verifyAllAreTaken();
 	doExecute();
 }
 
-void Command::parseArguments(args::Subparser& parser)
+void Command::parseArguments(CommandArguments&)
 {
-	parser.Parse();
 }
 
-String Command::getValueOf(PositionalString& argument)
+Command::Access Command::getAccess() const noexcept
 {
-	if (argument.Matched())
-	{
-		return args::get(argument);
-	}
-	else
-	{
-		throw MissingArgumentException(argument.Name());
-	}
-}
+	return Access::STORE;
+}
\ No newline at end of file
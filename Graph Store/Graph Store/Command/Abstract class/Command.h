@@ -1,37 +1,34 @@
 #ifndef __COMMAND_HEADER_INCLUDED__
 #define __COMMAND_HEADER_INCLUDED__
 
-#include "../../../../../args-master/args-master/args.hxx"
-
-class String;
+#include "Command/Command Arguments/CommandArguments.h"
 
 class Command
 {
 public:
-	class StringReader
+	/*
+		What a command touches besides the session that executes it.
+		Commands that only touch single graphs lock those graphs and can
+		be executed along with each other. The rest are executed alone.
+	*/
+	enum class Access
 	{
-	public:
-		void operator()(const std::string& name,
-						const std::string& value,
-						String& destination) const;
+		SESSION,
+		GRAPHS,
+		STORE
 	};
 
-protected:
-	using PositionalString = args::Positional<String, StringReader>;
-
 public:
 	Command(const Command&) = delete;
 	Command& operator=(const Command&) = delete;
 	virtual ~Command() = default;
 
-	void execute(args::Subparser& parser);
-
-protected:
-	static String getValueOf(PositionalString& argument);
+	void execute(CommandArguments& arguments);
+	virtual Access getAccess() const noexcept;
 
 protected:
 	Command() = default;
-	virtual void parseArguments(args::Subparser& parser) = 0;
+	virtual void parseArguments(CommandArguments& arguments);
 
 private:
 	virtual void doExecute() = 0;
@@ -1,42 +1,31 @@
 #include "AddEdgeCommand.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
+#include "Graph IO/Journal/Journal.h"
 
 static CommandRegistrator<AddEdgeCommand> registrator("add-edge",
 													  "Adds an edge between two vertices with a specified weight");
 
-void AddEdgeCommand::parseArguments(args::Subparser& parser)
+Command::Access AddEdgeCommand::getAccess() const noexcept
 {
-	PositionalString startID(parser, "start vertex id", "The id of the start vertex");
-	PositionalString endID(parser, "end vertex id", "The id of the end vertex");
-	PositionalWeight weight(parser, "weight", "The weight of the edge");
-
-	parser.Parse();
-
-	setStartVertexID(startID);
-	setEndVertexID(endID);
-	setWeight(weight);
-}
-
-void AddEdgeCommand::setStartVertexID(PositionalString& id)
-{
-	startVertexID = getValueOf(id);
-}
-
-void AddEdgeCommand::setEndVertexID(PositionalString& id)
-{
-	endVertexID = getValueOf(id);
+	return Access::GRAPHS;
 }
 
-void AddEdgeCommand::setWeight(PositionalWeight& w)
+void AddEdgeCommand::parseArguments(CommandArguments& arguments)
 {
-	weight = w.Matched() ? args::get(w) : DEFAULT_EDGE_WEIGHT;
+	startVertexID = arguments.takeArgument("start vertex id");
+	endVertexID = arguments.takeArgument("end vertex id");
+	weight = arguments.hasArgument() ?
+		     arguments.takeNumber<Graph::Edge::Weight>("weight") :
+		     DEFAULT_EDGE_WEIGHT;
 }
 
 void AddEdgeCommand::doExecute()
 {
 	Graph& usedGraph = getUsedGraph();
+	auto lock = lockForWriting(usedGraph);
 	Graph::Vertex& start = usedGraph.getVertexWithID(startVertexID);
 	Graph::Vertex& end = usedGraph.getVertexWithID(endVertexID);
 
 	usedGraph.addEdge(start, end, weight);
+	getJournal().logAddEdge(usedGraph.getID(), startVertexID, endVertexID, weight);
 }
@@ -6,19 +6,15 @@
 
 class AddEdgeCommand : public GraphCommand
 {
-	using PositionalWeight = args::Positional<Graph::Edge::Weight>;
-
 public:
 	AddEdgeCommand() = default;
 
+	Access getAccess() const noexcept override;
+
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
 
-	void setStartVertexID(PositionalString& id);
-	void setEndVertexID(PositionalString& id);
-	void setWeight(PositionalWeight& w);
-
 private:
 	static const Graph::Edge::Weight DEFAULT_EDGE_WEIGHT = 1;
 
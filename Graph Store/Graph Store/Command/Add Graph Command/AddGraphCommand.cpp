@@ -3,31 +3,19 @@
 #include "Graph Collection/GraphCollection.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
 #include "Command/Exceptions/CommandException.h"
+#include "Graph IO/Journal/Journal.h"
 
 static CommandRegistrator<AddGraphCommand> registrator("add-graph",
 	                                                   "Adds a graph with specified id and type");
 
 const String AddGraphCommand::DEFAULT_GRAPH_TYPE = "undirected";
 
-void AddGraphCommand::parseArguments(args::Subparser& parser)
+void AddGraphCommand::parseArguments(CommandArguments& arguments)
 {
-	PositionalString id(parser, "graph id", "The id of the new graph");
-	PositionalString type(parser, "graph type", "The type of the new graph");
-
-	parser.Parse();
-
-	setGraphID(id);
-	setGraphType(type);
-}
-
-void AddGraphCommand::setGraphID(PositionalString& id)
-{
-	graphID = getValueOf(id);
-}
-
-void AddGraphCommand::setGraphType(PositionalString& type)
-{
-	graphType = type.Matched() ? args::get(type) : DEFAULT_GRAPH_TYPE;
+	graphID = arguments.takeArgument("graph id");
+	graphType = arguments.hasArgument() ?
+		        arguments.takeArgument("graph type") :
+		        DEFAULT_GRAPH_TYPE;
 }
 
 void AddGraphCommand::doExecute()
@@ -38,6 +26,7 @@ void AddGraphCommand::doExecute()
 	
 	Graph* g = newGraph.get();
 	graphs.add(std::move(newGraph));
+	getJournal().logAddGraph(graphID, g->getType());
 	setUsedGraph(*g);
 }
 
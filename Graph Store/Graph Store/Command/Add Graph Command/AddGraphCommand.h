@@ -14,10 +14,8 @@ private:
 		                                                  const String& type);
 
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
-	void setGraphID(PositionalString& id);
-	void setGraphType(PositionalString& type);
 
 private:
 	static const String DEFAULT_GRAPH_TYPE;
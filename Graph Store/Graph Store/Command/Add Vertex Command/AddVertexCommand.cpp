@@ -1,20 +1,26 @@
 #include "AddVertexCommand.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
 #include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Journal/Journal.h"
 
 static CommandRegistrator<AddVertexCommand> registrator("add-vertex",
 	                                                    "Adds a vertex with a specified id");
 
-void AddVertexCommand::parseArguments(args::Subparser& parser)
+Command::Access AddVertexCommand::getAccess() const noexcept
 {
-	PositionalString id(parser, "vertex id", "The id of the new vertex");
-	parser.Parse();
-	vertexID = getValueOf(id);
+	return Access::GRAPHS;
+}
+
+void AddVertexCommand::parseArguments(CommandArguments& arguments)
+{
+	vertexID = arguments.takeArgument("vertex id");
 }
 
 void AddVertexCommand::doExecute()
 {
 	Graph& usedGraph = getUsedGraph();
-	
+	auto lock = lockForWriting(usedGraph);
+
 	usedGraph.addVertex(vertexID);
+	getJournal().logAddVertex(usedGraph.getID(), vertexID);
 }
@@ -0,0 +1,47 @@
+#include "BackgroundSaveCommand.h"
+#include "Command/Command Registrator/CommandRegistrator.h"
+#include "Command/Exceptions/CommandException.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Graph IO/Background Saver/BackgroundSaver.h"
+#include "Graph IO/Journal/Journal.h"
+#include <iostream>
+
+static CommandRegistrator<BackgroundSaveCommand> registrator("bgsave",
+	                                                         "Saves all modified graphs in the background");
+
+void BackgroundSaveCommand::doExecute()
+{
+	verifyNoBackgroundSaveIsInProgress();
+
+	auto graphsToSave = collectGraphsToSave();
+	getBackgroundSaver().start(graphsToSave,
+		                       getRequestedFormat(),
+		                       getJournal().getSize());
+
+	getOutput() << "Started saving " << graphsToSave.size()
+			  << " graphs in the background.\n";
+}
+
+void BackgroundSaveCommand::verifyNoBackgroundSaveIsInProgress() const
+{
+	if (getBackgroundSaver().isInProgress())
+	{
+		throw CommandException("A background save is already in progress!"_s);
+	}
+}
+
+std::vector<const Graph*> BackgroundSaveCommand::collectGraphsToSave()
+{
+	GraphCollection& graphs = getGraphs();
+	auto graphsToSave = std::vector<const Graph*>{};
+
+	graphs.forEachID([&](const String& id)
+	{
+		if (!isSavedInTheRequestedFormat(id))
+		{
+			graphsToSave.push_back(&graphs[id]);
+		}
+	});
+
+	return graphsToSave;
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef __BACKGROUND_SAVE_COMMAND_HEADER_INCLUDED__
+#define __BACKGROUND_SAVE_COMMAND_HEADER_INCLUDED__
+
+#include "Command/Save Command/SaveCommand.h"
+#include <vector>
+
+class BackgroundSaveCommand : public SaveCommand
+{
+public:
+	BackgroundSaveCommand() = default;
+
+private:
+	void doExecute() override;
+	void verifyNoBackgroundSaveIsInProgress() const;
+	std::vector<const Graph*> collectGraphsToSave();
+};
+
+#endif //__BACKGROUND_SAVE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
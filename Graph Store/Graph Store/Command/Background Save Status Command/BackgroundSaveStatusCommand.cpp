@@ -0,0 +1,36 @@
+#include "BackgroundSaveStatusCommand.h"
+#include "Command/Command Registrator/CommandRegistrator.h"
+#include "Graph IO/Background Saver/BackgroundSaver.h"
+#include <iostream>
+
+static CommandRegistrator<BackgroundSaveStatusCommand> registrator("bgsave-status",
+	                                                               "Reports the progress of the last background save");
+
+void BackgroundSaveStatusCommand::doExecute()
+{
+	using Status = GraphIO::BackgroundSaver::Status;
+
+	const GraphIO::BackgroundSaver& saver = getBackgroundSaver();
+	auto progress = [&saver]()
+	{
+		return std::to_string(saver.getSavedGraphsCount()) + " of "
+			   + std::to_string(saver.getGraphsCount()) + " graphs saved";
+	};
+
+	switch (saver.getStatus())
+	{
+	case Status::NOT_STARTED:
+		getOutput() << "No background save has been started.\n";
+		break;
+	case Status::IN_PROGRESS:
+		getOutput() << "Background save in progress: " << progress() << ".\n";
+		break;
+	case Status::SUCCEEDED:
+		getOutput() << "Background save completed: " << progress() << ".\n";
+		break;
+	case Status::FAILED:
+		getOutput() << "Background save failed: " << progress() << ".\n"
+				  << saver.getErrorMessage() << '\n';
+		break;
+	}
+}
\ No newline at end of file
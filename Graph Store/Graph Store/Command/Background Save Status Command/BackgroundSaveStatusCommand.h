@@ -0,0 +1,15 @@
+#ifndef __BACKGROUND_SAVE_STATUS_COMMAND_HEADER_INCLUDED__
+#define __BACKGROUND_SAVE_STATUS_COMMAND_HEADER_INCLUDED__
+
+#include "Command/Graph Command/GraphCommand.h"
+
+class BackgroundSaveStatusCommand : public GraphCommand
+{
+public:
+	BackgroundSaveStatusCommand() = default;
+
+private:
+	void doExecute() override;
+};
+
+#endif //__BACKGROUND_SAVE_STATUS_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "CheckpointCommand.h"
+#include "Graph IO/Checkpoint Saver/CheckpointSaver.h"
+#include "Graph IO/GraphIOConstants.h"
+#include "Graph IO/Journal/Journal.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Command/Command Registrator/CommandRegistrator.h"
+#include <iostream>
+
+static CommandRegistrator<CheckpointCommand> registrator("checkpoint",
+	                                                     "Writes all graphs to a single file that is used for faster startup");
+
+void CheckpointCommand::doExecute()
+{
+	GraphCollection& graphs = getGraphs();
+	auto checkpointID =
+		GraphIO::CheckpointSaver().save(graphs, GraphIO::CHECKPOINT_FILE_NAME);
+	getJournal().logCheckpoint(checkpointID);
+
+	getOutput() << "Wrote " << graphs.getCount() << " graphs to "
+			  << GraphIO::CHECKPOINT_FILE_NAME << ".\n";
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef __CHECKPOINT_COMMAND_HEADER_INCLUDED__
+#define __CHECKPOINT_COMMAND_HEADER_INCLUDED__
+
+#include "Command/Graph Command/GraphCommand.h"
+
+class CheckpointCommand : public GraphCommand
+{
+public:
+	CheckpointCommand() = default;
+
+private:
+	void doExecute() override;
+};
+
+#endif //__CHECKPOINT_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
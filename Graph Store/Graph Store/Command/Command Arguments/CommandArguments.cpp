@@ -0,0 +1,122 @@
+#include "CommandArguments.h"
+#include "Command/Exceptions/MissingArgumentException.h"
+#include <algorithm>
+
+CommandArguments::CommandArguments(Words& words) noexcept :
+	words(words),
+	nextArgument(0)
+{
+}
+
+bool CommandArguments::takeFlag(const char* name)
+{
+	auto option = findOption(name);
+
+	if (option != words.end())
+	{
+		words.erase(option);
+		return true;
+	}
+
+	return false;
+}
+
+std::optional<CommandArguments::Word>
+CommandArguments::takeOptionValueWord(const char* name)
+{
+	auto option = findOption(name);
+
+	if (option == words.end())
+	{
+		return std::nullopt;
+	}
+
+	auto separator = option->find('=');
+
+	if (separator != Word::npos)
+	{
+		auto value = option->substr(separator + 1);
+		words.erase(option);
+
+		return value;
+	}
+	else if (std::next(option) == words.end())
+	{
+		throw CommandException("Expected a value for --" + String(name));
+	}
+
+	auto value = *std::next(option);
+	words.erase(option, option + 2);
+
+	return value;
+}
+
+CommandArguments::Words::iterator
+CommandArguments::findOption(Word name) noexcept
+{
+	return std::find_if(words.begin(), words.end(), [name](Word word)
+	{
+		if (!isOption(word))
+		{
+			return false;
+		}
+
+		word.remove_prefix(2);
+		word = word.substr(0, word.find('='));
+
+		return word == name;
+	});
+}
+
+bool CommandArguments::hasArgument() const noexcept
+{
+	return nextArgument < words.size();
+}
+
+String CommandArguments::takeArgument(const char* name)
+{
+	return toString(takeArgumentWord(name));
+}
+
+CommandArguments::Word CommandArguments::takeArgumentWord(const char* name)
+{
+	if (!hasArgument())
+	{
+		throw MissingArgumentException(name);
+	}
+
+	Word word = words[nextArgument];
+	verifyIsNotOption(word);
+	++nextArgument;
+
+	return word;
+}
+
+void CommandArguments::verifyAllAreTaken() const
+{
+	if (hasArgument())
+	{
+		Word word = words[nextArgument];
+		verifyIsNotOption(word);
+
+		throw CommandException("Unexpected argument: " + toString(word));
+	}
+}
+
+void CommandArguments::verifyIsNotOption(Word word)
+{
+	if (isOption(word))
+	{
+		throw CommandException("Unknown option: " + toString(word));
+	}
+}
+
+bool CommandArguments::isOption(Word word) noexcept
+{
+	return word.size() > 2 && word.substr(0, 2) == "--";
+}
+
+String CommandArguments::toString(Word word)
+{
+	return String(word.data());
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef __COMMAND_ARGUMENTS_HEADER_INCLUDED__
+#define __COMMAND_ARGUMENTS_HEADER_INCLUDED__
+
+#include "String/String.h"
+#include "Command/Exceptions/CommandException.h"
+#include <charconv>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/*
+	The words passed to a command, viewed in place in the command line as
+	StringCutter leaves it, so each word is followed by a null character.
+	Options are the words starting with "--" and may be given anywhere,
+	which is why a command takes its options before its positional
+	arguments.
+*/
+class CommandArguments
+{
+public:
+	using Word = std::string_view;
+	using Words = std::vector<Word>;
+
+public:
+	explicit CommandArguments(Words& words) noexcept;
+
+	bool takeFlag(const char* name);
+	template <class Number>
+	std::optional<Number> takeOptionValue(const char* name);
+
+	bool hasArgument() const noexcept;
+	String takeArgument(const char* name);
+	template <class Number>
+	Number takeNumber(const char* name);
+
+	void verifyAllAreTaken() const;
+
+private:
+	static bool isOption(Word word) noexcept;
+	static void verifyIsNotOption(Word word);
+	static String toString(Word word);
+	template <class Number>
+	static Number toNumber(Word word, const char* name);
+
+private:
+	Words::iterator findOption(Word name) noexcept;
+	std::optional<Word> takeOptionValueWord(const char* name);
+	Word takeArgumentWord(const char* name);
+
+private:
+	Words& words;
+	std::size_t nextArgument;
+};
+
+template <class Number>
+std::optional<Number> CommandArguments::takeOptionValue(const char* name)
+{
+	auto value = takeOptionValueWord(name);
+
+	return value ? std::optional<Number>(toNumber<Number>(*value, name)) :
+		           std::nullopt;
+}
+
+template <class Number>
+Number CommandArguments::takeNumber(const char* name)
+{
+	return toNumber<Number>(takeArgumentWord(name), name);
+}
+
+template <class Number>
+Number CommandArguments::toNumber(Word word, const char* name)
+{
+	auto number = Number{};
+	auto end = word.data() + word.size();
+	auto result = std::from_chars(word.data(), end, number);
+
+	if (result.ec != std::errc{} || result.ptr != end)
+	{
+		throw CommandException("Expected a number for [" + String(name)
+			                   + "], got: " + toString(word));
+	}
+
+	return number;
+}
+
+#endif //__COMMAND_ARGUMENTS_HEADER_INCLUDED__
\ No newline at end of file
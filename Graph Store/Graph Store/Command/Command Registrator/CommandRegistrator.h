@@ -3,20 +3,29 @@
 
 #include "Application/Application.h"
 
+/*
+	Commands keep the arguments of the command line they execute, so
+	each thread executes commands with its own instance.
+*/
 template <class ConcreteCommand>
 class CommandRegistrator
 {
 public:
 	CommandRegistrator(const char* name, const char* description)
 	{
-		Application::instance().addCommand(name, description, command);
+		Application::instance().addCommand(name, description, getCommandOfThisThread);
 	}
 
 	CommandRegistrator(const CommandRegistrator<ConcreteCommand>&) = delete;
 	CommandRegistrator<ConcreteCommand>& operator=(const CommandRegistrator<ConcreteCommand>&) = delete;
 
 private:
-	ConcreteCommand command;
+	static Command& getCommandOfThisThread()
+	{
+		thread_local ConcreteCommand command;
+
+		return command;
+	}
 };
 
 #endif //__COMMAND_REGISTRATOR_HEADER_INCLUDED__
\ No newline at end of file
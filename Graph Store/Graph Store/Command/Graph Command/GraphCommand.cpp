@@ -1,10 +1,28 @@
 #include "GraphCommand.h"
 #include "Runtime Error/RuntimeError.h"
 #include  "Graph Collection/GraphCollection.h"
+#include "Session/Session.h"
 #include <assert.h>
 
-Graph* GraphCommand::usedGraph = nullptr;
 GraphCollection* GraphCommand::graphs = nullptr;
+GraphIO::Journal* GraphCommand::journal = nullptr;
+GraphIO::BackgroundSaver* GraphCommand::backgroundSaver = nullptr;
+GraphIO::GraphFileWatcher* GraphCommand::fileWatcher = nullptr;
+GraphIO::PathIndex* GraphCommand::pathIndex = nullptr;
+
+/*
+	Commands that touch single graphs lock them, because they may run
+	along with other such commands.
+*/
+GraphCommand::ReadLock GraphCommand::lockForReading(const Graph& g)
+{
+	return ReadLock(g.getMutex());
+}
+
+GraphCommand::WriteLock GraphCommand::lockForWriting(const Graph& g)
+{
+	return WriteLock(g.getMutex());
+}
 
 GraphCollection& GraphCommand::getGraphs()
 {
@@ -13,11 +31,19 @@ GraphCollection& GraphCommand::getGraphs()
 	return *graphs;
 }
 
+/*
+	Sessions keep the id of the used graph, so a graph that is reloaded
+	from its file stays used, while one that is removed by another session
+	is no longer used.
+*/
 Graph& GraphCommand::getUsedGraph()
 {
-	if (usedGraph != nullptr)
+	Session& session = Session::current();
+
+	if (session.hasUsedGraph()
+		&& getGraphs().contains(session.getUsedGraphID()))
 	{
-		return *usedGraph;
+		return getGraphs()[session.getUsedGraphID()];
 	}
 	else
 	{
@@ -27,21 +53,76 @@ Graph& GraphCommand::getUsedGraph()
 
 void GraphCommand::setUsedGraph(Graph& g)
 {
-	usedGraph = &g;
+	Session::current().useGraph(g.getID());
 }
 
 void GraphCommand::useNoGraph()
 {
-	usedGraph = nullptr;
+	Session::current().useNoGraph();
 }
 
 bool GraphCommand::isUsedGraph(const String& id)
 {
-	return usedGraph != nullptr
-		   && usedGraph->getID() == id;
+	Session& session = Session::current();
+
+	return session.hasUsedGraph()
+		   && session.getUsedGraphID() == id;
+}
+
+std::ostream& GraphCommand::getOutput()
+{
+	return Session::current().getOutput();
+}
+
+GraphIO::Journal& GraphCommand::getJournal()
+{
+	assert(journal != nullptr);
+
+	return *journal;
+}
+
+GraphIO::BackgroundSaver& GraphCommand::getBackgroundSaver()
+{
+	assert(backgroundSaver != nullptr);
+
+	return *backgroundSaver;
+}
+
+GraphIO::GraphFileWatcher& GraphCommand::getFileWatcher()
+{
+	assert(fileWatcher != nullptr);
+
+	return *fileWatcher;
+}
+
+GraphIO::PathIndex& GraphCommand::getPathIndex()
+{
+	assert(pathIndex != nullptr);
+
+	return *pathIndex;
 }
 
 void GraphCommand::setGraphs(GraphCollection& collection)
 {
 	graphs = &collection;
 }
+
+void GraphCommand::setJournal(GraphIO::Journal& j)
+{
+	journal = &j;
+}
+
+void GraphCommand::setBackgroundSaver(GraphIO::BackgroundSaver& saver)
+{
+	backgroundSaver = &saver;
+}
+
+void GraphCommand::setFileWatcher(GraphIO::GraphFileWatcher& watcher)
+{
+	fileWatcher = &watcher;
+}
+
+void GraphCommand::setPathIndex(GraphIO::PathIndex& index)
+{
+	pathIndex = &index;
+}
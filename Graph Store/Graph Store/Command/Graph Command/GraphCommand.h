@@ -2,30 +2,59 @@
 #define __GRAPH_COMMAND_HEADER_INCLUDED__
 
 #include "Command/Abstract Class/Command.h"
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
 
 class Graph;
 class GraphCollection;
 
+namespace GraphIO
+{
+	class Journal;
+	class BackgroundSaver;
+	class GraphFileWatcher;
+	class PathIndex;
+}
+
 class GraphCommand : public Command
 {
 	friend class Application;
 
+protected:
+	using ReadLock = std::shared_lock<std::shared_mutex>;
+	using WriteLock = std::unique_lock<std::shared_mutex>;
+
 protected:
 	GraphCommand() = default;
 
 protected:
+	static ReadLock lockForReading(const Graph& g);
+	static WriteLock lockForWriting(const Graph& g);
 	static GraphCollection& getGraphs();
 	static Graph& getUsedGraph();
 	static void setUsedGraph(Graph& g);
 	static void useNoGraph();
 	static bool isUsedGraph(const String& id);
+	static std::ostream& getOutput();
+	static GraphIO::Journal& getJournal();
+	static GraphIO::BackgroundSaver& getBackgroundSaver();
+	static GraphIO::GraphFileWatcher& getFileWatcher();
+	static GraphIO::PathIndex& getPathIndex();
 
 private:
 	static void setGraphs(GraphCollection& graphs);
+	static void setJournal(GraphIO::Journal& journal);
+	static void setBackgroundSaver(GraphIO::BackgroundSaver& saver);
+	static void setFileWatcher(GraphIO::GraphFileWatcher& watcher);
+	static void setPathIndex(GraphIO::PathIndex& index);
 
 private:
-	static Graph* usedGraph;
 	static GraphCollection* graphs;
+	static GraphIO::Journal* journal;
+	static GraphIO::BackgroundSaver* backgroundSaver;
+	static GraphIO::GraphFileWatcher* fileWatcher;
+	static GraphIO::PathIndex* pathIndex;
 };
 
 #endif //__GRAPH_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
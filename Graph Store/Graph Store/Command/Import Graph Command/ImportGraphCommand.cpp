@@ -0,0 +1,78 @@
+#include "ImportGraphCommand.h"
+#include "Graph IO/Graph Importer/Abstract class/GraphImporter.h"
+#include "Graph IO/Background Saver/BackgroundSaver.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Journal/Journal.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Command/Command Registrator/CommandRegistrator.h"
+#include "Command/Exceptions/CommandException.h"
+#include <iostream>
+
+static CommandRegistrator<ImportGraphCommand> registrator("import-graph",
+	                                                      "Imports a graph from a DIMACS, SNAP or Matrix Market file");
+
+void ImportGraphCommand::parseArguments(CommandArguments& arguments)
+{
+	isUndirected = arguments.takeFlag("undirected");
+	fileName = arguments.takeArgument("file");
+	format = arguments.takeArgument("format");
+	graphID = arguments.takeArgument("graph id");
+}
+
+void ImportGraphCommand::doExecute()
+{
+	verifyNoGraphHasTheRequestedID();
+	finishBackgroundSave();
+
+	auto importer = GraphIO::GraphImporter::createFor(format);
+
+	if (isUndirected)
+	{
+		importer->makeUndirected();
+	}
+
+	GraphCollection::GraphPointer newGraph = importer->importFrom(fileName, graphID);
+	GraphCollection& graphs = getGraphs();
+
+	Graph* g = newGraph.get();
+	graphs.add(std::move(newGraph));
+	save(*g);
+	graphs.markAsSaved(graphID);
+	setUsedGraph(*g);
+	printSummary(*g, *importer);
+}
+
+void ImportGraphCommand::verifyNoGraphHasTheRequestedID() const
+{
+	if (getGraphs().contains(graphID))
+	{
+		throw CommandException("There already is a graph with id: " + graphID);
+	}
+}
+
+void ImportGraphCommand::finishBackgroundSave()
+{
+	GraphIO::BackgroundSaver& backgroundSaver = getBackgroundSaver();
+
+	if (backgroundSaver.isInProgress())
+	{
+		backgroundSaver.finish(getGraphs(), getJournal());
+	}
+}
+
+void ImportGraphCommand::save(const Graph& g)
+{
+	GraphIO::save(g, GraphIO::FileFormat::TEXT);
+	getJournal().logImportGraph(g.getID());
+}
+
+void ImportGraphCommand::printSummary(const Graph& g,
+	                                  const GraphIO::GraphImporter& importer) const
+{
+	getOutput() << "Imported " << g.getID() << " with "
+			  << g.getVerticesCount() << " vertices and "
+			  << g.getEdgesCount() << " edges ("
+			  << importer.getMergedEdgesCount()
+			  << " duplicate edges merged keeping the lowest weight, "
+			  << importer.getSkippedLoopsCount() << " loops skipped).\n";
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef __IMPORT_GRAPH_COMMAND_HEADER_INCLUDED__
+#define __IMPORT_GRAPH_COMMAND_HEADER_INCLUDED__
+
+#include "Command/Graph Command/GraphCommand.h"
+#include "String/String.h"
+
+namespace GraphIO
+{
+	class GraphImporter;
+}
+
+class ImportGraphCommand : public GraphCommand
+{
+public:
+	ImportGraphCommand() = default;
+
+private:
+	void parseArguments(CommandArguments& arguments) override;
+	void doExecute() override;
+	void verifyNoGraphHasTheRequestedID() const;
+	void finishBackgroundSave();
+	void save(const Graph& g);
+	void printSummary(const Graph& g,
+		              const GraphIO::GraphImporter& importer) const;
+
+private:
+	String fileName;
+	String format;
+	String graphID;
+	bool isUndirected;
+};
+
+#endif //__IMPORT_GRAPH_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
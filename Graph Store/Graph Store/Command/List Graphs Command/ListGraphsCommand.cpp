@@ -6,20 +6,12 @@
 static CommandRegistrator<ListGraphsCommand> registrator("list-graphs",
 														 "Lists the ids of all graphs");
 
-void ListGraphsCommand::parseArguments(args::Subparser& parser)
-{
-	Command::parseArguments(parser);
-}
-
 void ListGraphsCommand::doExecute()
 {
 	GraphCollection& graphs = getGraphs();
 
-	GraphCollection::ConstIterator iterator =
-		graphs.getConstIterator();
-
-	forEach(iterator, [](const Graph& g)
+	graphs.forEachID([](const String& id)
 	{
-		std::cout << g.getID() << '\n';
+		getOutput() << id << '\n';
 	});
 }
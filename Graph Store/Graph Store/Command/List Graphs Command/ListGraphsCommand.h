@@ -9,7 +9,6 @@ public:
 	ListGraphsCommand() = default;
 
 private:
-	void parseArguments(args::Subparser& parser) override;
 	void doExecute() override;
 };
 
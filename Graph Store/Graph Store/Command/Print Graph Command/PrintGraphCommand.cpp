@@ -2,60 +2,101 @@
 #include "Command/Command Registrator/CommandRegistrator.h"
 #include "Graph Collection/GraphCollection.h"
 #include "Graph IO/GraphIOConstants.h"
-#include <iostream>
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Mapped Graph/MappedGraph.h"
 
 static CommandRegistrator<PrintGraphCommand> registrator("print-graph",
 	                                                     "Prints a specified graph");
 
-void PrintGraphCommand::parseArguments(args::Subparser& parser)
+Command::Access PrintGraphCommand::getAccess() const noexcept
 {
-	PositionalString id(parser, "graph id", "The id of the graph to print");
-	parser.Parse();
-	setGraphID(id);
+	return Access::GRAPHS;
 }
 
-void PrintGraphCommand::setGraphID(PositionalString& id)
+void PrintGraphCommand::parseArguments(CommandArguments& arguments)
 {
-	graphID = id.Matched() ? args::get(id) : getUsedGraph().getID();
+	graphID = arguments.hasArgument() ?
+		      arguments.takeArgument("graph id") :
+		      getUsedGraph().getID();
 }
 
 void PrintGraphCommand::doExecute()
 {
-	GraphCollection& graphs = getGraphs();
-	Graph& graph = graphs[graphID];
+	if (canBePrintedInPlace())
+	{
+		GraphIO::MappedGraph graph;
+		graph.open(GraphIO::getBinaryFileNameFor(graphID));
+		print(graph);
+	}
+	else
+	{
+		const Graph& g = getGraphs()[graphID];
+		auto lock = lockForReading(g);
+
+		print(g);
+	}
+}
+
+bool PrintGraphCommand::canBePrintedInPlace() const
+{
+	return !getGraphs().isLoaded(graphID)
+		   && GraphIO::getFormatOfFileFor(graphID) == GraphIO::FileFormat::BINARY;
+}
 
+void PrintGraphCommand::print(const Graph& g)
+{
 	Graph::VerticesConstIterator iterator =
-		graph.getConstIteratorOfVertices();
+		g.getConstIteratorOfVertices();
 
 	forEach(*iterator, [&](const Graph::Vertex& v)
 	{
-		printEdgesLeaving(v, graph);
+		printEdgesLeaving(v, g);
 	});
 }
 
+void PrintGraphCommand::print(const GraphIO::MappedGraph& g)
+{
+	for (auto i = std::size_t{ 0 }; i < g.getVerticesCount(); ++i)
+	{
+		printEdgesLeaving(i, g);
+	}
+}
+
 void PrintGraphCommand::printEdgesLeaving(const Graph::Vertex& v,
 	                                      const Graph& g)
 {
-	std::cout << v.getID() << ": ";
+	getOutput() << v.getID() << ": ";
 
 	Graph::OutgoingEdgesConstIterator iterator =
 		g.getConstIteratorOfEdgesLeaving(v);
 
 	forEach(*iterator, [&](const Graph::OutgoingEdge& e)
 	{
-		printEdge(e);
+		printEdge(e.getWeight(), e.getEnd().getID().cString());
 	});
 
-	std::cout << '\n';
+	getOutput() << '\n';
 }
 
-void PrintGraphCommand::printEdge(const Graph::OutgoingEdge& e)
+void PrintGraphCommand::printEdgesLeaving(std::size_t vertexIndex,
+	                                      const GraphIO::MappedGraph& g)
 {
-	using namespace GraphIO;
+	getOutput() << g.getVertexID(vertexIndex) << ": ";
+
+	g.forEachEdgeLeaving(vertexIndex, [&g](std::size_t end, Graph::OutgoingEdge::Weight weight)
+	{
+		printEdge(weight, g.getVertexID(end));
+	});
+
+	getOutput() << '\n';
+}
 
-	const Graph::Vertex& end = e.getEnd();
+void PrintGraphCommand::printEdge(Graph::OutgoingEdge::Weight weight,
+	                              const char* endID)
+{
+	using namespace GraphIO;
 
-	std::cout << EDGE_START << e.getWeight()
+	getOutput() << EDGE_START << weight
 		      << EDGE_ATTRIBUTE_SEPARATOR << ' '
-		      << end.getID() << EDGE_END << ", ";
+		      << endID << EDGE_END << ", ";
 }
@@ -4,19 +4,30 @@
 #include "Command/Graph Command/GraphCommand.h"
 #include "Graph/Abstract class/Graph.h"
 
+namespace GraphIO
+{
+	class MappedGraph;
+}
+
 class PrintGraphCommand : public GraphCommand
 {
 public:
 	PrintGraphCommand() = default;
 
+	Access getAccess() const noexcept override;
+
 private:
+	static void print(const Graph& g);
+	static void print(const GraphIO::MappedGraph& g);
 	static void printEdgesLeaving(const Graph::Vertex& v, const Graph& g);
-	static void printEdge(const Graph::OutgoingEdge& e);
+	static void printEdgesLeaving(std::size_t vertexIndex,
+		                          const GraphIO::MappedGraph& g);
+	static void printEdge(Graph::OutgoingEdge::Weight weight, const char* endID);
 
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
-	void setGraphID(PositionalString& id);
+	bool canBePrintedInPlace() const;
 
 private:
 	String graphID;
@@ -1,26 +1,29 @@
 #include "RemoveEdgeCommand.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
 #include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Journal/Journal.h"
 
 static CommandRegistrator<RemoveEdgeCommand> registrator("remove-edge",
 														 "Removes the edge between two specified vertices");
 
-void RemoveEdgeCommand::parseArguments(args::Subparser& parser)
+Command::Access RemoveEdgeCommand::getAccess() const noexcept
 {
-	PositionalString startID(parser, "start vertex id", "The id of the start vertex");
-	PositionalString endID(parser, "end vertex id", "The id of the end vertex");
-
-	parser.Parse();
+	return Access::GRAPHS;
+}
 
-	this->startID = getValueOf(startID);
-	this->endID = getValueOf(endID);
+void RemoveEdgeCommand::parseArguments(CommandArguments& arguments)
+{
+	startID = arguments.takeArgument("start vertex id");
+	endID = arguments.takeArgument("end vertex id");
 }
 
 void RemoveEdgeCommand::doExecute()
 {
 	Graph& usedGraph = getUsedGraph();
+	auto lock = lockForWriting(usedGraph);
 	Graph::Vertex& start = usedGraph.getVertexWithID(startID);
 	Graph::Vertex& end = usedGraph.getVertexWithID(endID);
 
 	usedGraph.removeEdge(start, end);
+	getJournal().logRemoveEdge(usedGraph.getID(), startID, endID);
 }
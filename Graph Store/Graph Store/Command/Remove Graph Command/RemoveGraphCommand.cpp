@@ -2,15 +2,14 @@
 #include "Command/Command Registrator/CommandRegistrator.h"
 #include "Graph Collection/GraphCollection.h"
 #include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Journal/Journal.h"
 
 static CommandRegistrator<RemoveGraphCommand> registrator("remove-graph",
 	                                                      "Removes a specified graph");
 
-void RemoveGraphCommand::parseArguments(args::Subparser& parser)
+void RemoveGraphCommand::parseArguments(CommandArguments& arguments)
 {
-	PositionalString id(parser, "graph id", "The id of the graph to remove");
-	parser.Parse();
-	graphID = getValueOf(id);
+	graphID = arguments.takeArgument("graph id");
 }
 
 void RemoveGraphCommand::doExecute()
@@ -21,8 +20,8 @@ void RemoveGraphCommand::doExecute()
 	}
 
 	GraphCollection& graphs = getGraphs();
-	GraphCollection::GraphPointer graph =
-		graphs.remove(graphID);
+	graphs.remove(graphID);
 
-	GraphIO::removeFileFor(*graph);
+	GraphIO::removeFileFor(graphID);
+	getJournal().logRemoveGraph(graphID);
 }
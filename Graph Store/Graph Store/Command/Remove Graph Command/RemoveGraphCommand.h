@@ -10,7 +10,7 @@ public:
 	RemoveGraphCommand() = default;
 
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
 
 private:
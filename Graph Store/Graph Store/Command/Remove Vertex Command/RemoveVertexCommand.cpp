@@ -1,21 +1,27 @@
 #include "RemoveVertexCommand.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
 #include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Journal/Journal.h"
 
 static CommandRegistrator<RemoveVertexCommand> registrator("remove-vertex",
 														   "Removes a vertex with a specified id");
 
-void RemoveVertexCommand::parseArguments(args::Subparser& parser)
+Command::Access RemoveVertexCommand::getAccess() const noexcept
 {
-	PositionalString id(parser, "vertex id", "The id of the vertex to remove");
-	parser.Parse();
-	vertexID = getValueOf(id);
+	return Access::GRAPHS;
+}
+
+void RemoveVertexCommand::parseArguments(CommandArguments& arguments)
+{
+	vertexID = arguments.takeArgument("vertex id");
 }
 
 void RemoveVertexCommand::doExecute()
 {
 	Graph& usedGraph = getUsedGraph();
+	auto lock = lockForWriting(usedGraph);
 	Graph::Vertex& v = usedGraph.getVertexWithID(vertexID);
 
 	usedGraph.removeVertex(v);
+	getJournal().logRemoveVertex(usedGraph.getID(), vertexID);
 }
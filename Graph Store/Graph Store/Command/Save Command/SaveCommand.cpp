@@ -1,24 +1,89 @@
 #include "SaveCommand.h"
-#include "Graph IO/Graph Saver/GraphSaver.h"
+#include "Graph IO/Journal/Journal.h"
+#include "Graph IO/Background Saver/BackgroundSaver.h"
+#include "Graph IO/Path Index/PathIndex.h"
+#include "Graph/Abstract class/Graph.h"
 #include "Graph Collection/GraphCollection.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
+#include "Command/Exceptions/CommandException.h"
+#include <iostream>
 
-static CommandRegistrator<SaveCommand> registrator("save", "Saves all graphs");
+static CommandRegistrator<SaveCommand> registrator("save", "Saves all modified graphs");
 
-void SaveCommand::parseArguments(args::Subparser& parser)
+void SaveCommand::parseArguments(CommandArguments& arguments)
 {
-	Command::parseArguments(parser);
+	bool isBinary = arguments.takeFlag("binary");
+	bool isCompressed = arguments.takeFlag("compressed");
+	setFormat(isBinary, isCompressed);
+}
+
+void SaveCommand::setFormat(bool isBinary, bool isCompressed)
+{
+	if (isBinary && isCompressed)
+	{
+		throw CommandException("Only one file format can be requested!"_s);
+	}
+
+	format = isBinary ?
+		GraphIO::FileFormat::BINARY :
+		isCompressed ?
+		GraphIO::FileFormat::COMPRESSED :
+		GraphIO::FileFormat::TEXT;
 }
 
 void SaveCommand::doExecute()
 {
-	GraphIO::GraphSaver saver;
-	const GraphCollection& graphs = getGraphs();
-	GraphCollection::ConstIterator iterator =
-		graphs.getConstIterator();
+	finishBackgroundSave();
+
+	GraphCollection& graphs = getGraphs();
+	auto savedGraphsCount = std::size_t{ 0 };
 
-	forEach(iterator, [&](const Graph& g)
+	graphs.forEachID([&](const String& id)
 	{
-		saver.save(g);
+		if (!isSavedInTheRequestedFormat(id))
+		{
+			save(graphs[id]);
+			graphs.markAsSaved(id);
+			++savedGraphsCount;
+		}
 	});
+
+	getJournal().clear();
+	getPathIndex().saveChanges(graphs);
+	printSummary(savedGraphsCount);
+}
+
+bool SaveCommand::isSavedInTheRequestedFormat(const String& id) const
+{
+	return !getGraphs().isModified(id)
+		   && GraphIO::fileExists(GraphIO::getFileNameFor(id, format));
+}
+
+GraphIO::FileFormat SaveCommand::getRequestedFormat() const noexcept
+{
+	return format;
+}
+
+void SaveCommand::finishBackgroundSave()
+{
+	GraphIO::BackgroundSaver& backgroundSaver = getBackgroundSaver();
+
+	if (backgroundSaver.isInProgress())
+	{
+		backgroundSaver.finish(getGraphs(), getJournal());
+	}
+}
+
+void SaveCommand::save(const Graph& g)
+{
+	GraphIO::save(g, format);
+
+	getOutput() << "Saved " << g.getID() << " to "
+			  << GraphIO::getFileNameFor(g.getID(), format) << '\n';
+}
+
+void SaveCommand::printSummary(std::size_t savedGraphsCount) const
+{
+	getOutput() << "Saved " << savedGraphsCount << " of "
+			  << getGraphs().getCount() << " graphs.\n";
 }
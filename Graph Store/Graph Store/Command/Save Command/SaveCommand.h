@@ -2,15 +2,27 @@
 #define __SAVE_COMMAND_HEADER_INCLUDED__
 
 #include "Command/Graph Command/GraphCommand.h"
+#include "Graph IO/GraphFilesFunctions.h"
 
 class SaveCommand : public GraphCommand
 {
 public:
 	SaveCommand() = default;
 
+protected:
+	bool isSavedInTheRequestedFormat(const String& id) const;
+	GraphIO::FileFormat getRequestedFormat() const noexcept;
+	void finishBackgroundSave();
+
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
+	void setFormat(bool isBinary, bool isCompressed);
+	void save(const Graph& g);
+	void printSummary(std::size_t savedGraphsCount) const;
+
+private:
+	GraphIO::FileFormat format;
 };
 
 #endif //__SAVE_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -2,34 +2,184 @@
 #include "Shortest Path Algorithms/Store/ShortestPathAlgorithmsStore.h"
 #include "Shortest Path Algorithms/Abstract class/ShortestPathAlgorithm.h"
 #include "Command/Command Registrator/CommandRegistrator.h"
+#include "Interrupt Guard/InterruptGuard.h"
+#include <cmath>
 
 static CommandRegistrator<SearchCommand> registrator("search",
 	                                                 "Finds a shortest path between two vertices");
 
-void SearchCommand::parseArguments(args::Subparser& parser)
+const String SearchCommand::AUTO_ALGORITHM_ID = "auto";
+PathCache SearchCommand::cache;
+std::mutex SearchCommand::cacheMutex;
+
+Command::Access SearchCommand::getAccess() const noexcept
 {
-	PositionalString sourceID(parser, "source id", "The id of the source vertex");
-	PositionalString targetID(parser, "target id", "The id of the target vertex");
-	PositionalString algorithmID(parser, "algorithm id", "The algorithm to use");
+	return Access::GRAPHS;
+}
 
-	parser.Parse();
+void SearchCommand::parseArguments(CommandArguments& arguments)
+{
+	shouldExplainChoice = arguments.takeFlag("explain");
+	shouldPrintStatistics = arguments.takeFlag("stats");
+	auto timeLimit = arguments.takeOptionValue<unsigned>("timeout");
+	auto workLimit = arguments.takeOptionValue<std::size_t>("max-settled");
 
-	this->sourceID = getValueOf(sourceID);
-	this->targetID = getValueOf(targetID);
-	this->algorithmID = getValueOf(algorithmID);
+	sourceID = arguments.takeArgument("source id");
+	targetID = arguments.takeArgument("target id");
+	algorithmID = arguments.takeArgument("algorithm id");
+	budget = SearchBudget{};
+	budget.setTimeLimit(SearchBudget::Duration(timeLimit.value_or(0)));
+	budget.setWorkLimit(workLimit.value_or(0));
 }
 
 void SearchCommand::doExecute()
 {
 	Graph& usedGraph = getUsedGraph();
+	auto lock = lockForReading(usedGraph);
 	Graph::Vertex& source = usedGraph.getVertexWithID(sourceID);
 	Graph::Vertex& target = usedGraph.getVertexWithID(targetID);
 
 	ShortestPathAlgorithm& algorithm =
-		ShortestPathAlgorithmsStore::instance()[algorithmID];
+		getAlgorithmFor(algorithmID, source, usedGraph);
+
+	if (shouldExplainChoice)
+	{
+		explainChoiceOf(algorithm, source, usedGraph);
+	}
+
+	auto query = createQueryFor(usedGraph, algorithm);
+	auto path = searchCacheFor(query, usedGraph);
+	auto isCachedResult = path.has_value();
+
+	if (!isCachedResult)
+	{
+		path = findShortestPath(algorithm, usedGraph, source, target);
+		addToCache(std::move(query), *path, usedGraph);
+	}
 
-	ShortestPathAlgorithm::Path p =
-		algorithm.findShortestPath(usedGraph, source, target);
+	getOutput() << *path << '\n';
 
-	std::cout << p << '\n';
+	if (shouldPrintStatistics)
+	{
+		printStatistics(algorithm, isCachedResult);
+	}
 }
+
+/*
+	The cache is shared by the searches of all threads, so the found paths
+	are copied out of it while it is locked. The path index is read before
+	the cache is locked so that its file is not read under that lock.
+*/
+std::optional<ShortestPathAlgorithm::Path>
+SearchCommand::searchCacheFor(const PathCache::Query& query, const Graph& g)
+{
+	auto indexedEntries = getPathIndex().load(g);
+	auto lock = std::lock_guard<std::mutex>(cacheMutex);
+
+	for (auto& entry : indexedEntries)
+	{
+		cache.add(std::move(entry.first), std::move(entry.second));
+	}
+
+	const ShortestPathAlgorithm::Path* p = cache.search(query);
+
+	return (p != nullptr) ?
+		   std::optional<ShortestPathAlgorithm::Path>(*p) :
+		   std::nullopt;
+}
+
+void SearchCommand::addToCache(PathCache::Query query,
+							   const ShortestPathAlgorithm::Path& path,
+							   const Graph& g)
+{
+	auto entries = GraphIO::PathIndex::Entries{};
+
+	{
+		auto lock = std::lock_guard<std::mutex>(cacheMutex);
+
+		cache.add(std::move(query), path);
+		cache.forEachEntryOf(g.getID(), g.getVersion(), [&entries](const PathCache::Query& q,
+			                                                       const PathCache::Path& p)
+		{
+			entries.emplace_back(q, p);
+		});
+	}
+
+	getPathIndex().update(g, std::move(entries));
+}
+
+ShortestPathAlgorithm::Path
+SearchCommand::findShortestPath(ShortestPathAlgorithm& algorithm,
+								const Graph& g,
+								const Graph::Vertex& source,
+								const Graph::Vertex& target)
+{
+	auto interruptGuard = InterruptGuard{};
+	budget.setCancellationFlag(interruptGuard.getInterruptionFlag());
+
+	return algorithm.findShortestPath(g, source, target, budget);
+}
+
+void SearchCommand::printStatistics(const ShortestPathAlgorithm& algorithm,
+									bool isCachedResult) const
+{
+	if (isCachedResult)
+	{
+		getOutput() << "The result was taken from the cache.\n";
+	}
+	else
+	{
+		getOutput() << algorithm.getStatisticsOfLastSearch();
+	}
+
+	auto lock = std::lock_guard<std::mutex>(cacheMutex);
+
+	getOutput() << "Cache hits: " << cache.getHitsCount()
+		      << ", misses: " << cache.getMissesCount() << '\n';
+}
+
+ShortestPathAlgorithm&
+SearchCommand::getAlgorithmFor(const String& id,
+							   const Graph::Vertex& source,
+							   const Graph& g)
+{
+	auto& algorithms = ShortestPathAlgorithmsStore::instance();
+
+	return (id == AUTO_ALGORITHM_ID) ?
+		   algorithms.getCheapestForSearchFrom(source, g) :
+		   algorithms[id];
+}
+
+void SearchCommand::explainChoiceOf(const ShortestPathAlgorithm& algorithm,
+									const Graph::Vertex& source,
+									const Graph& g)
+{
+	auto iterator = ShortestPathAlgorithmsStore::instance().getIterator();
+
+	forEach(iterator, [&source, &g](const ShortestPathAlgorithm* a)
+	{
+		getOutput() << a->getID() << ": ";
+		printCost(a->estimateCostOfSearchFrom(source, g));
+		getOutput() << '\n';
+	});
+
+	getOutput() << "Chosen algorithm: " << algorithm.getID() << '\n';
+}
+
+void SearchCommand::printCost(ShortestPathAlgorithm::Cost cost)
+{
+	if (cost != ShortestPathAlgorithm::getInfiniteCost())
+	{
+		getOutput() << "estimated cost " << std::ceil(cost);
+	}
+	else
+	{
+		getOutput() << "not applicable";
+	}
+}
+
+PathCache::Query SearchCommand::createQueryFor(const Graph& g,
+											   const ShortestPathAlgorithm& a) const
+{
+	return { g.getID(), g.getVersion(), sourceID, targetID, a.getID() };
+}
\ No newline at end of file
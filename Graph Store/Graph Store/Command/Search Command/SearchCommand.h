@@ -3,20 +3,56 @@
 
 #include "Command/Graph Command/GraphCommand.h"
 #include "String/String.h"
+#include "Shortest Path Algorithms/Path Cache/PathCache.h"
+#include "Graph IO/Path Index/PathIndex.h"
+#include <mutex>
+#include <optional>
 
 class SearchCommand : public GraphCommand
 {
 public:
 	SearchCommand() = default;
 
+	Access getAccess() const noexcept override;
+
+private:
+	static ShortestPathAlgorithm& getAlgorithmFor(const String& id,
+		                                          const Graph::Vertex& source,
+		                                          const Graph& g);
+	static void explainChoiceOf(const ShortestPathAlgorithm& algorithm,
+		                        const Graph::Vertex& source,
+		                        const Graph& g);
+	static void printCost(ShortestPathAlgorithm::Cost cost);
+	static std::optional<ShortestPathAlgorithm::Path>
+		searchCacheFor(const PathCache::Query& query, const Graph& g);
+	static void addToCache(PathCache::Query query,
+		                   const ShortestPathAlgorithm::Path& path,
+		                   const Graph& g);
+
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
+	PathCache::Query createQueryFor(const Graph& g,
+		                            const ShortestPathAlgorithm& a) const;
+	ShortestPathAlgorithm::Path findShortestPath(ShortestPathAlgorithm& algorithm,
+		                                         const Graph& g,
+		                                         const Graph::Vertex& source,
+		                                         const Graph::Vertex& target);
+	void printStatistics(const ShortestPathAlgorithm& algorithm,
+		                 bool isCachedResult) const;
+
+private:
+	static const String AUTO_ALGORITHM_ID;
+	static PathCache cache;
+	static std::mutex cacheMutex;
 
 private:
 	String sourceID;
 	String targetID;
 	String algorithmID;
+	bool shouldExplainChoice;
+	bool shouldPrintStatistics;
+	SearchBudget budget;
 };
 
 #endif //__SEARCH_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
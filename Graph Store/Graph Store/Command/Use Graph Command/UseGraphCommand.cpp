@@ -5,11 +5,14 @@
 static CommandRegistrator<UseGraphCommand> registrator("use-graph",
 	                                                   "Sets a specified graph as the used one");
 
-void UseGraphCommand::parseArguments(args::Subparser& parser)
+Command::Access UseGraphCommand::getAccess() const noexcept
 {
-	PositionalString id(parser, "graph id", "The id of the graph to use");
-	parser.Parse();
-	graphID = getValueOf(id);
+	return Access::GRAPHS;
+}
+
+void UseGraphCommand::parseArguments(CommandArguments& arguments)
+{
+	graphID = arguments.takeArgument("graph id");
 }
 
 void UseGraphCommand::doExecute()
@@ -9,8 +9,10 @@ class UseGraphCommand : public GraphCommand
 public:
 	UseGraphCommand() = default;
 
+	Access getAccess() const noexcept override;
+
 private:
-	void parseArguments(args::Subparser& parser) override;
+	void parseArguments(CommandArguments& arguments) override;
 	void doExecute() override;
 
 private:
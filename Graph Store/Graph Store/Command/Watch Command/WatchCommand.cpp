@@ -0,0 +1,58 @@
+#include "WatchCommand.h"
+#include "Graph IO/Graph File Watcher/GraphFileWatcher.h"
+#include "Command/Command Registrator/CommandRegistrator.h"
+#include "Command/Exceptions/CommandException.h"
+#include <iostream>
+
+static CommandRegistrator<WatchCommand> registrator("watch",
+	                                                "Reloads graph files that are changed by other programs");
+
+void WatchCommand::parseArguments(CommandArguments& arguments)
+{
+	interval = arguments.takeOptionValue<unsigned>("interval").value_or(unsigned{ DEFAULT_INTERVAL });
+	shouldStop = arguments.takeFlag("stop");
+}
+
+void WatchCommand::doExecute()
+{
+	if (shouldStop)
+	{
+		stopWatching();
+	}
+	else
+	{
+		startWatching();
+	}
+}
+
+void WatchCommand::startWatching()
+{
+	GraphIO::GraphFileWatcher& watcher = getFileWatcher();
+
+	if (watcher.isWatching())
+	{
+		throw CommandException("The graph files are already watched!"_s);
+	}
+	else if (interval == 0)
+	{
+		throw CommandException("The interval must be positive!"_s);
+	}
+
+	watcher.start("."_s, GraphIO::GraphFileWatcher::Interval(interval));
+
+	getOutput() << "Watching the graph files every " << interval << " ms.\n";
+}
+
+void WatchCommand::stopWatching()
+{
+	GraphIO::GraphFileWatcher& watcher = getFileWatcher();
+
+	if (!watcher.isWatching())
+	{
+		throw CommandException("The graph files are not watched!"_s);
+	}
+
+	watcher.stop();
+
+	getOutput() << "Stopped watching the graph files.\n";
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifndef __WATCH_COMMAND_HEADER_INCLUDED__
+#define __WATCH_COMMAND_HEADER_INCLUDED__
+
+#include "Command/Graph Command/GraphCommand.h"
+
+class WatchCommand : public GraphCommand
+{
+public:
+	WatchCommand() = default;
+
+private:
+	void parseArguments(CommandArguments& arguments) override;
+	void doExecute() override;
+	void startWatching();
+	void stopWatching();
+
+private:
+	static const unsigned DEFAULT_INTERVAL = 1000;
+
+private:
+	unsigned interval;
+	bool shouldStop;
+};
+
+#endif //__WATCH_COMMAND_HEADER_INCLUDED__
\ No newline at end of file
@@ -2,22 +2,31 @@
 #define __EXTENSION_FILTER_HEADER_INCLUDED__
 
 #include "String/String.h"
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
 
 class ExtensionFilter
 {
 public:
-	explicit ExtensionFilter(String extension) noexcept :
-		extension(std::move(extension))
+	explicit ExtensionFilter(String extension) :
+		extensions{ std::move(extension) }
+	{
+	}
+
+	ExtensionFilter(std::initializer_list<String> extensions) :
+		extensions(extensions)
 	{
 	}
 
 	bool operator()(const String& extension) const
 	{
-		return extension == this->extension;
+		return std::find(extensions.cbegin(), extensions.cend(), extension)
+			   != extensions.cend();
 	}
 
 private:
-	String extension;
+	std::vector<String> extensions;
 };
 
 #endif //__EXTENSION_FILTER_HEADER_INCLUDED__
\ No newline at end of file
@@ -19,6 +19,16 @@ Distance::Distance(unsigned distance) noexcept :
 {
 }
 
+bool Distance::isInfinite() const noexcept
+{
+	return isInfinity;
+}
+
+unsigned Distance::getValue() const noexcept
+{
+	return distance;
+}
+
 const Distance operator+(const Distance& lhs,
 	                     const Distance& rhs) noexcept
 {
@@ -14,6 +14,9 @@ public:
 
 	Distance& operator+=(const Distance& rhs) noexcept;
 
+	bool isInfinite() const noexcept;
+	unsigned getValue() const noexcept;
+
 	friend std::ostream& operator<<(std::ostream& output,
 		                            const Distance& d);
 	friend bool operator==(const Distance& lhs,
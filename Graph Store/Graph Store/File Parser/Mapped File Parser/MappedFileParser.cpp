@@ -0,0 +1,123 @@
+#include "MappedFileParser.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include "String/String.h"
+#include <utility>
+
+MappedFileParser::MappedFileParser(const String& fileName)
+{
+	openFile(fileName);
+}
+
+MappedFileParser::MappedFileParser(MappedFileParser&& source) noexcept
+{
+	swapContentsWith(source);
+}
+
+MappedFileParser& MappedFileParser::operator=(MappedFileParser&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		closeFile();
+		swapContentsWith(rhs);
+	}
+
+	return *this;
+}
+
+void MappedFileParser::swapContentsWith(MappedFileParser& parser) noexcept
+{
+	std::swap(file, parser.file);
+	std::swap(this->parser, parser.parser);
+}
+
+void MappedFileParser::openFile(const String& fileName)
+{
+	closeFile();
+
+	try
+	{
+		file.open(fileName);
+	}
+	catch (OpenFileFailException&)
+	{
+		throw OpenFileFailException("Could not open file for reading, name: " + fileName);
+	}
+
+	parser = TextRangeParser(file.getData(), file.getData() + file.getSize());
+}
+
+void MappedFileParser::closeFile() noexcept
+{
+	file.close();
+	parser = TextRangeParser();
+}
+
+bool MappedFileParser::hasOpenedFile() const noexcept
+{
+	return file.isOpen();
+}
+
+bool MappedFileParser::hasReachedEnd() const
+{
+	verifyAFileIsOpened();
+
+	return parser.hasReachedEnd();
+}
+
+String MappedFileParser::readLine()
+{
+	verifyAFileIsOpened();
+
+	return parser.readLine();
+}
+
+String MappedFileParser::readAndTrimLine()
+{
+	verifyAFileIsOpened();
+
+	return parser.readAndTrimLine();
+}
+
+void MappedFileParser::skipUntil(char character)
+{
+	verifyAFileIsOpened();
+	parser.skipUntil(character);
+}
+
+void MappedFileParser::skipSpaces()
+{
+	verifyAFileIsOpened();
+	parser.skipSpaces();
+}
+
+char MappedFileParser::peek()
+{
+	verifyAFileIsOpened();
+
+	return parser.peek();
+}
+
+unsigned MappedFileParser::parseUnsigned()
+{
+	verifyAFileIsOpened();
+
+	return parser.parseUnsigned();
+}
+
+std::vector<TextRangeParser>
+MappedFileParser::splitRemainderBefore(char partStart,
+	                                   std::size_t maxPartsCount,
+	                                   std::size_t minPartSize) const
+{
+	verifyAFileIsOpened();
+
+	return parser.splitBefore(partStart, maxPartsCount, minPartSize);
+}
+
+void MappedFileParser::verifyAFileIsOpened() const
+{
+	if (!hasOpenedFile())
+	{
+		throw FileParserException("No file is currently opened!"_s);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef __MAPPED_FILE_PARSER_HEADER_INCLUDED__
+#define __MAPPED_FILE_PARSER_HEADER_INCLUDED__
+
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include "File Parser/Text Range Parser/TextRangeParser.h"
+
+class MappedFileParser
+{
+public:
+	MappedFileParser() = default;
+	explicit MappedFileParser(const String& fileName);
+	MappedFileParser(const MappedFileParser&) = delete;
+	MappedFileParser& operator=(const MappedFileParser&) = delete;
+	MappedFileParser(MappedFileParser&& source) noexcept;
+	MappedFileParser& operator=(MappedFileParser&& rhs) noexcept;
+	~MappedFileParser() = default;
+
+	void openFile(const String& fileName);
+	void closeFile() noexcept;
+	bool hasReachedEnd() const;
+	bool hasOpenedFile() const noexcept;
+
+	String readLine();
+	String readAndTrimLine();
+	unsigned parseUnsigned();
+	char peek();
+	void skipUntil(char character);
+	void skipSpaces();
+
+	std::vector<TextRangeParser> splitRemainderBefore(char partStart,
+		                                              std::size_t maxPartsCount,
+		                                              std::size_t minPartSize) const;
+
+private:
+	void verifyAFileIsOpened() const;
+	void swapContentsWith(MappedFileParser& parser) noexcept;
+
+private:
+	MemoryMappedFile file;
+	TextRangeParser parser;
+};
+
+#endif //__MAPPED_FILE_PARSER_HEADER_INCLUDED__
\ No newline at end of file
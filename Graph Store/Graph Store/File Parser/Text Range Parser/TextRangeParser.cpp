@@ -0,0 +1,211 @@
+#include "TextRangeParser.h"
+#include "File Parser/File Parser Exception/FileParserException.h"
+#include "String/String.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <assert.h>
+
+TextRangeParser::TextRangeParser() noexcept :
+	TextRangeParser(nullptr, nullptr, 0)
+{
+}
+
+TextRangeParser::TextRangeParser(const char* begin,
+	                             const char* end,
+	                             unsigned firstLineNumber) noexcept :
+	position(begin),
+	end(end),
+	lineNumber(firstLineNumber)
+{
+	assert(begin <= end);
+}
+
+bool TextRangeParser::hasReachedEnd() const noexcept
+{
+	return position == end;
+}
+
+unsigned TextRangeParser::getLineNumber() const noexcept
+{
+	return lineNumber;
+}
+
+String TextRangeParser::readLine()
+{
+	if (hasReachedEnd())
+	{
+		throwException("No more characters left in the file!");
+	}
+
+	auto endOfLine = find('\n', position);
+	auto lineEnd = endOfLine;
+
+	if (lineEnd != position && *(lineEnd - 1) == '\r')
+	{
+		--lineEnd;
+	}
+
+	auto line = std::string(position, lineEnd);
+	moveTo(endOfLine == end ? end : endOfLine + 1);
+
+	return String(line.c_str());
+}
+
+String TextRangeParser::readAndTrimLine()
+{
+	auto line = readLine();
+	auto start = line.cString();
+	auto length = std::strlen(start);
+
+	while (length > 0 && start[length - 1] == ' ')
+	{
+		--length;
+	}
+
+	while (length > 0 && *start == ' ')
+	{
+		++start;
+		--length;
+	}
+
+	return String(std::string(start, length).c_str());
+}
+
+bool TextRangeParser::skipUntil(char character)
+{
+	auto found = find(character, position);
+	auto isFound = found != end;
+
+	moveTo(isFound ? found + 1 : end);
+
+	return isFound;
+}
+
+const char*
+TextRangeParser::find(char character, const char* from) const noexcept
+{
+	if (from == end)
+	{
+		return end;
+	}
+
+	auto found = static_cast<const char*>(
+		std::memchr(from, character, end - from)
+	);
+
+	return found != nullptr ? found : end;
+}
+
+void TextRangeParser::moveTo(const char* newPosition) noexcept
+{
+	assert(position <= newPosition && newPosition <= end);
+
+	lineNumber += static_cast<unsigned>(std::count(position, newPosition, '\n'));
+	position = newPosition;
+}
+
+void TextRangeParser::skipSpaces()
+{
+	verifyEndIsNotReached();
+
+	while (position != end && *position == ' ')
+	{
+		++position;
+	}
+}
+
+char TextRangeParser::peek()
+{
+	verifyEndIsNotReached();
+
+	return *position;
+}
+
+unsigned TextRangeParser::parseUnsigned()
+{
+	skipSpaces();
+
+	if (peek() == '-')
+	{
+		throwException("Number must not be negative!");
+	}
+
+	skipWhitespace();
+
+	auto number = 0u;
+	auto result = std::from_chars(position, end, number);
+
+	if (result.ec != std::errc())
+	{
+		throwException("Invalid number format!");
+	}
+
+	position = result.ptr;
+
+	return number;
+}
+
+void TextRangeParser::skipWhitespace() noexcept
+{
+	auto first = position;
+
+	while (first != end && isWhitespace(*first))
+	{
+		++first;
+	}
+
+	moveTo(first);
+}
+
+bool TextRangeParser::isWhitespace(char c) noexcept
+{
+	return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+std::vector<TextRangeParser>
+TextRangeParser::splitBefore(char partStart,
+	                         std::size_t maxPartsCount,
+	                         std::size_t minPartSize) const
+{
+	assert(maxPartsCount > 0);
+
+	auto parts = std::vector<TextRangeParser>{};
+	auto partSize = std::max<std::size_t>({ (end - position) / maxPartsCount,
+		                                    minPartSize,
+		                                    1 });
+	auto partBegin = position;
+	auto partLineNumber = lineNumber;
+
+	while (partBegin != end)
+	{
+		auto approximateEnd =
+			(static_cast<std::size_t>(end - partBegin) > partSize) ? partBegin + partSize : end;
+		auto partEnd = parts.size() + 1 < maxPartsCount ?
+			find(partStart, approximateEnd) :
+			end;
+
+		parts.emplace_back(partBegin, partEnd, partLineNumber);
+		partLineNumber += static_cast<unsigned>(std::count(partBegin, partEnd, '\n'));
+		partBegin = partEnd;
+	}
+
+	return parts;
+}
+
+void TextRangeParser::verifyEndIsNotReached() const
+{
+	if (hasReachedEnd())
+	{
+		throwException("End of file already reached!");
+	}
+}
+
+void TextRangeParser::throwException(const char* message) const
+{
+	assert(message != nullptr);
+
+	std::string suffix = " Error at line " + std::to_string(lineNumber);
+	throw FileParserException(message + suffix);
+}
\ No newline at end of file
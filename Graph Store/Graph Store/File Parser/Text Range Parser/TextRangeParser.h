@@ -0,0 +1,47 @@
+#ifndef __TEXT_RANGE_PARSER_HEADER_INCLUDED__
+#define __TEXT_RANGE_PARSER_HEADER_INCLUDED__
+
+#include <cstddef>
+#include <vector>
+
+class String;
+
+class TextRangeParser
+{
+public:
+	TextRangeParser() noexcept;
+	TextRangeParser(const char* begin,
+		            const char* end,
+		            unsigned firstLineNumber = 1) noexcept;
+
+	bool hasReachedEnd() const noexcept;
+	unsigned getLineNumber() const noexcept;
+
+	String readLine();
+	String readAndTrimLine();
+	unsigned parseUnsigned();
+	char peek();
+	bool skipUntil(char character);
+	void skipSpaces();
+
+	std::vector<TextRangeParser> splitBefore(char partStart,
+		                                     std::size_t maxPartsCount,
+		                                     std::size_t minPartSize) const;
+
+private:
+	static bool isWhitespace(char c) noexcept;
+
+private:
+	const char* find(char character, const char* from) const noexcept;
+	void moveTo(const char* newPosition) noexcept;
+	void skipWhitespace() noexcept;
+	void verifyEndIsNotReached() const;
+	void throwException(const char* message) const;
+
+private:
+	const char* position;
+	const char* end;
+	unsigned lineNumber;
+};
+
+#endif //__TEXT_RANGE_PARSER_HEADER_INCLUDED__
\ No newline at end of file
@@ -9,24 +9,30 @@ GraphCollection::GraphCollection(std::size_t size)
 void GraphCollection::add(GraphPointer graph)
 {
 	verifyPointerIsNotNull(graph);
+	verifyNoGraphHasID(graph->getID());
+	tryToAdd(Entry(std::move(graph)));
+}
 
-	const String& id = graph->getID();
+void GraphCollection::addUnloaded(const String& id, Loader loader)
+{
+	verifyLoaderIsNotNull(loader);
+	verifyNoGraphHasID(id);
+	tryToAdd(Entry(id, std::move(loader)));
+}
 
-	if (!contains(id))
-	{
-		tryToAdd(std::move(graph));
-	}
-	else
+void GraphCollection::verifyNoGraphHasID(const String& id) const
+{
+	if (contains(id))
 	{
 		throw RuntimeError("There already is a graph with id: " + id);
 	}
 }
 
-void GraphCollection::tryToAdd(GraphPointer graph)
+void GraphCollection::tryToAdd(Entry entry)
 {
 	try
 	{
-		graphs.push_back(std::move(graph));
+		graphs.push_back(std::move(entry));
 	}
 	catch (std::bad_alloc&)
 	{
@@ -42,6 +48,14 @@ void GraphCollection::verifyPointerIsNotNull(const GraphPointer& p)
 	}
 }
 
+void GraphCollection::verifyLoaderIsNotNull(const Loader& loader)
+{
+	if (!loader)
+	{
+		throw RuntimeError("Expected a graph loader!"_s);
+	}
+}
+
 bool GraphCollection::isEmpty() const noexcept
 {
 	return getCount() == 0;
@@ -52,6 +66,20 @@ std::size_t GraphCollection::getCount() const noexcept
 	return graphs.size();
 }
 
+GraphCollection::GraphPointer
+GraphCollection::replace(GraphPointer graph)
+{
+	verifyPointerIsNotNull(graph);
+
+	Collection::iterator iterator =
+		getGraph(graphs.begin(), graphs.end(), graph->getID());
+
+	GraphPointer replacedGraph = iterator->releaseGraph();
+	*iterator = Entry(std::move(graph));
+
+	return replacedGraph;
+}
+
 Graph& GraphCollection::operator[](const String& id)
 {
 	const GraphCollection& collection = *this;
@@ -65,7 +93,21 @@ GraphCollection::operator[](const String& id) const
 	Collection::const_iterator iterator =
 		getGraph(graphs.cbegin(), graphs.cend(), id);
 	
-	return *(*iterator);
+	return iterator->getGraph();
+}
+
+/*
+	Builds a separate copy of a graph that is not loaded yet with the
+	graph's own loader, leaving the collection unchanged. Returns nullptr
+	if the graph is already loaded.
+*/
+GraphCollection::GraphPointer
+GraphCollection::getUnloaded(const String& id) const
+{
+	Collection::const_iterator iterator =
+		getGraph(graphs.cbegin(), graphs.cend(), id);
+
+	return iterator->buildUnloadedGraph();
 }
 
 bool GraphCollection::contains(const String& id) const
@@ -75,6 +117,38 @@ bool GraphCollection::contains(const String& id) const
 		             id) != graphs.cend();
 }
 
+bool GraphCollection::isLoaded(const String& id) const
+{
+	Collection::const_iterator iterator =
+		getGraph(graphs.cbegin(), graphs.cend(), id);
+
+	return iterator->isLoaded();
+}
+
+bool GraphCollection::isModified(const String& id) const
+{
+	Collection::const_iterator iterator =
+		getGraph(graphs.cbegin(), graphs.cend(), id);
+
+	return iterator->isModified();
+}
+
+void GraphCollection::markAsSaved(const String& id)
+{
+	Collection::iterator iterator =
+		getGraph(graphs.begin(), graphs.end(), id);
+
+	iterator->markAsSaved();
+}
+
+void GraphCollection::markAsSaved(const String& id, Graph::Version version)
+{
+	Collection::iterator iterator =
+		getGraph(graphs.begin(), graphs.end(), id);
+
+	iterator->markAsSaved(version);
+}
+
 void GraphCollection::empty()
 {
 	graphs.clear();
@@ -86,7 +160,7 @@ GraphCollection::remove(const String& id)
 	Collection::iterator iterator =
 		getGraph(graphs.begin(), graphs.end(), id);
 
-	GraphPointer graphToRemove = std::move(*iterator);
+	GraphPointer graphToRemove = iterator->releaseGraph();
 	graphs.erase(iterator);
 	
 	return graphToRemove;
@@ -103,3 +177,125 @@ GraphCollection::getConstIterator() const noexcept
 {
 	return ConstIterator(graphs.cbegin(), graphs.cend());
 }
+
+
+GraphCollection::Entry::Entry(GraphPointer graph) noexcept :
+	id(graph->getID()),
+	graph(std::move(graph))
+{
+}
+
+/*
+	Graphs that are loaded on first use may be used by several commands
+	at a time, so loading them is guarded by a lock.
+*/
+GraphCollection::Entry::Entry(String id, Loader loader) :
+	id(std::move(id)),
+	loader(std::move(loader)),
+	loadingMutex(std::make_unique<std::mutex>())
+{
+}
+
+const String& GraphCollection::Entry::getID() const noexcept
+{
+	return id;
+}
+
+bool GraphCollection::Entry::isLoaded() const noexcept
+{
+	if (loadingMutex != nullptr)
+	{
+		auto lock = std::lock_guard<std::mutex>(*loadingMutex);
+
+		return hasGraph();
+	}
+
+	return hasGraph();
+}
+
+bool GraphCollection::Entry::hasGraph() const noexcept
+{
+	return graph != nullptr;
+}
+
+bool GraphCollection::Entry::isModified() const noexcept
+{
+	return hasGraph() && graph->getVersion() != savedVersion;
+}
+
+void GraphCollection::Entry::markAsSaved() noexcept
+{
+	if (hasGraph())
+	{
+		savedVersion = graph->getVersion();
+	}
+}
+
+void GraphCollection::Entry::markAsSaved(Graph::Version version) noexcept
+{
+	if (hasGraph())
+	{
+		savedVersion = version;
+	}
+}
+
+Graph& GraphCollection::Entry::getGraph() const
+{
+	if (loadingMutex != nullptr)
+	{
+		auto lock = std::lock_guard<std::mutex>(*loadingMutex);
+
+		if (!hasGraph())
+		{
+			load();
+		}
+	}
+
+	return *graph;
+}
+
+GraphCollection::GraphPointer
+GraphCollection::Entry::buildUnloadedGraph() const
+{
+	if (loadingMutex == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto lock = std::lock_guard<std::mutex>(*loadingMutex);
+
+	if (hasGraph())
+	{
+		return nullptr;
+	}
+
+	GraphPointer result = loader();
+	verifyHasTheExpectedID(result);
+
+	return result;
+}
+
+void GraphCollection::Entry::load() const
+{
+	assert(!hasGraph());
+
+	GraphPointer loadedGraph = loader();
+	verifyHasTheExpectedID(loadedGraph);
+	graph = std::move(loadedGraph);
+	loader = nullptr;
+	savedVersion = graph->getVersion();
+}
+
+void GraphCollection::Entry::verifyHasTheExpectedID(const GraphPointer& graph) const
+{
+	if (graph == nullptr || graph->getID() != id)
+	{
+		throw RuntimeError("The graph with id " + id + " could not be loaded!");
+	}
+}
+
+GraphCollection::GraphPointer
+GraphCollection::Entry::releaseGraph() noexcept
+{
+	return std::move(graph);
+}
\ No newline at end of file
@@ -6,14 +6,46 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <functional>
+#include <optional>
+#include <mutex>
 
 class GraphCollection
 {
 public:
 	using GraphPointer = std::unique_ptr<Graph>;
+	using Loader = std::function<GraphPointer()>;
 
 private:
-	using Collection = std::vector<GraphPointer>;
+	class Entry
+	{
+	public:
+		explicit Entry(GraphPointer graph) noexcept;
+		Entry(String id, Loader loader);
+
+		const String& getID() const noexcept;
+		bool isLoaded() const noexcept;
+		bool isModified() const noexcept;
+		void markAsSaved() noexcept;
+		void markAsSaved(Graph::Version version) noexcept;
+		Graph& getGraph() const;
+		GraphPointer buildUnloadedGraph() const;
+		GraphPointer releaseGraph() noexcept;
+
+	private:
+		bool hasGraph() const noexcept;
+		void load() const;
+		void verifyHasTheExpectedID(const GraphPointer& graph) const;
+
+	private:
+		String id;
+		mutable GraphPointer graph;
+		mutable Loader loader;
+		mutable std::optional<Graph::Version> savedVersion;
+		std::unique_ptr<std::mutex> loadingMutex;
+	};
+
+	using Collection = std::vector<Entry>;
 
 public:
 	template <bool isConst = false>
@@ -46,7 +78,7 @@ public:
 		{
 			assert(isValid());
 
-			return *(*iterator);
+			return (*iterator).getGraph();
 		}
 
 		bool isValid() const override
@@ -70,11 +102,21 @@ public:
 	GraphCollection& operator=(GraphCollection&&) = default;
 
 	void add(GraphPointer graph);
+	void addUnloaded(const String& id, Loader loader);
 	GraphPointer remove(const String& id);
+	GraphPointer replace(GraphPointer graph);
 
 	Graph& operator[](const String& id);
 	const Graph& operator[](const String& id) const;
+	GraphPointer getUnloaded(const String& id) const;
 	bool contains(const String& id) const;
+	bool isLoaded(const String& id) const;
+	bool isModified(const String& id) const;
+	void markAsSaved(const String& id);
+	void markAsSaved(const String& id, Graph::Version version);
+
+	template <class Function>
+	void forEachID(Function f) const;
 
 	Iterator getIterator() noexcept;
 	ConstIterator getConstIterator() const noexcept;
@@ -85,6 +127,7 @@ public:
 
 private:
 	static void verifyPointerIsNotNull(const GraphPointer& p);
+	static void verifyLoaderIsNotNull(const Loader& loader);
 	template <class ForwardIterator>
 	static ForwardIterator getGraph(ForwardIterator begin,
 		                            ForwardIterator end,
@@ -94,12 +137,22 @@ private:
 		                             ForwardIterator end,
 		                             const String& id);
 private:
-	void tryToAdd(GraphPointer graph);
+	void verifyNoGraphHasID(const String& id) const;
+	void tryToAdd(Entry entry);
 
 private:
 	Collection graphs;
 };
 
+template <class Function>
+void GraphCollection::forEachID(Function f) const
+{
+	std::for_each(graphs.cbegin(), graphs.cend(), [&f](const Entry& entry)
+	{
+		f(entry.getID());
+	});
+}
+
 template <class ForwardIterator>
 ForwardIterator GraphCollection::getGraph(ForwardIterator begin,
 	                                      ForwardIterator end,
@@ -123,11 +176,9 @@ ForwardIterator GraphCollection::findGraph(ForwardIterator begin,
 	                                       ForwardIterator end,
 	                                       const String& id)
 {
-	return std::find_if(begin, end, [&id](const auto& graph)
+	return std::find_if(begin, end, [&id](const Entry& entry)
 	{
-		assert(graph != nullptr);
-
-		return graph->getID() == id;
+		return entry.getID() == id;
 	});
 }
 
@@ -0,0 +1,186 @@
+#include "BackgroundSaver.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Graph Factory/GraphFactory.h"
+#include "Graph IO/Journal/Journal.h"
+#include <exception>
+#include <assert.h>
+
+namespace GraphIO
+{
+	BackgroundSaver::BackgroundSaver() noexcept :
+		format(FileFormat::TEXT),
+		journalSize(0),
+		isStarted(false),
+		isFinished(false),
+		savedGraphsCount(0),
+		isDoneSaving(false)
+	{
+	}
+
+	BackgroundSaver::~BackgroundSaver()
+	{
+		waitForWorker();
+	}
+
+	void BackgroundSaver::start(const std::vector<const Graph*>& graphs,
+		                        FileFormat format,
+		                        std::size_t journalSize)
+	{
+		assert(!isInProgress());
+
+		waitForWorker();
+		takeSnapshotsOf(graphs);
+		this->format = format;
+		this->journalSize = journalSize;
+		savedGraphsCount = 0;
+		isDoneSaving = false;
+		errorMessage.clear();
+
+		worker = std::thread([this]() noexcept { saveSnapshots(); });
+		isStarted = true;
+		isFinished = false;
+	}
+
+	void BackgroundSaver::takeSnapshotsOf(const std::vector<const Graph*>& graphs)
+	{
+		snapshots.clear();
+		snapshots.reserve(graphs.size());
+
+		for (auto g : graphs)
+		{
+			snapshots.push_back({ makeSnapshotOf(*g), g->getVersion() });
+		}
+	}
+
+	BackgroundSaver::GraphPointer BackgroundSaver::makeSnapshotOf(const Graph& g)
+	{
+		auto ids = std::vector<String>{};
+		ids.reserve(g.getVerticesCount());
+
+		auto vertices = g.getConstIteratorOfVertices();
+
+		forEach(*vertices, [&ids](const auto& vertex)
+		{
+			ids.push_back(vertex.getID());
+		});
+
+		auto edges = std::vector<Graph::IndexedEdge>{};
+		edges.reserve(g.getEdgesCount());
+
+		auto edgesIterator = g.getConstIteratorOfEdges();
+
+		forEach(*edgesIterator, [&edges](const auto& edge)
+		{
+			edges.push_back({ edge.getStart().getIndex(),
+				              edge.getEnd().getIndex(),
+				              edge.getWeight() });
+		});
+
+		auto snapshot = GraphFactory::instance().createGraph(g.getType(), g.getID());
+		snapshot->addVerticesAndEdges(ids, edges);
+
+		return snapshot;
+	}
+
+	void BackgroundSaver::saveSnapshots() noexcept
+	{
+		try
+		{
+			for (const auto& snapshot : snapshots)
+			{
+				save(*snapshot.graph, format);
+				++savedGraphsCount;
+			}
+		}
+		catch (std::exception& e)
+		{
+			errorMessage = e.what();
+		}
+		catch (...)
+		{
+			errorMessage = "Unknown error";
+		}
+
+		isDoneSaving = true;
+	}
+
+	void BackgroundSaver::finish(GraphCollection& graphs, Journal& journal)
+	{
+		assert(isInProgress());
+
+		waitForWorker();
+		isFinished = true;
+		markSavedGraphsIn(graphs);
+
+		if (getStatus() == Status::SUCCEEDED)
+		{
+			journal.discardRecordsBefore(journalSize);
+		}
+	}
+
+	void BackgroundSaver::markSavedGraphsIn(GraphCollection& graphs) const
+	{
+		for (auto i = std::size_t{ 0 }; i < savedGraphsCount; ++i)
+		{
+			const String& id = snapshots[i].graph->getID();
+
+			if (graphs.contains(id))
+			{
+				graphs.markAsSaved(id, snapshots[i].version);
+			}
+			else
+			{
+				removeFileFor(id);
+			}
+		}
+	}
+
+	void BackgroundSaver::waitForWorker() noexcept
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+
+	bool BackgroundSaver::isInProgress() const noexcept
+	{
+		return isStarted && !isFinished;
+	}
+
+	bool BackgroundSaver::hasFinishedSaving() const noexcept
+	{
+		return isInProgress() && isDoneSaving;
+	}
+
+	BackgroundSaver::Status BackgroundSaver::getStatus() const noexcept
+	{
+		if (!isStarted)
+		{
+			return Status::NOT_STARTED;
+		}
+		else if (!isDoneSaving)
+		{
+			return Status::IN_PROGRESS;
+		}
+		else
+		{
+			return errorMessage.empty() ? Status::SUCCEEDED : Status::FAILED;
+		}
+	}
+
+	std::size_t BackgroundSaver::getSavedGraphsCount() const noexcept
+	{
+		return savedGraphsCount;
+	}
+
+	std::size_t BackgroundSaver::getGraphsCount() const noexcept
+	{
+		return snapshots.size();
+	}
+
+	const std::string& BackgroundSaver::getErrorMessage() const noexcept
+	{
+		return errorMessage;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef __BACKGROUND_SAVER_HEADER_INCLUDED__
+#define __BACKGROUND_SAVER_HEADER_INCLUDED__
+
+#include "Graph/Abstract class/Graph.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class GraphCollection;
+
+namespace GraphIO
+{
+	class Journal;
+
+	/*
+		Saves copies of graphs on a separate thread so that the graphs
+		themselves can be changed while their files are written.
+		The copies are made by start, on the calling thread.
+	*/
+	class BackgroundSaver
+	{
+		using GraphPointer = std::unique_ptr<Graph>;
+
+		struct Snapshot
+		{
+			GraphPointer graph;
+			Graph::Version version;
+		};
+
+	public:
+		enum class Status
+		{
+			NOT_STARTED,
+			IN_PROGRESS,
+			SUCCEEDED,
+			FAILED
+		};
+
+	public:
+		BackgroundSaver() noexcept;
+		BackgroundSaver(const BackgroundSaver&) = delete;
+		BackgroundSaver& operator=(const BackgroundSaver&) = delete;
+		~BackgroundSaver();
+
+		void start(const std::vector<const Graph*>& graphs,
+			       FileFormat format,
+			       std::size_t journalSize);
+		void finish(GraphCollection& graphs, Journal& journal);
+
+		bool isInProgress() const noexcept;
+		bool hasFinishedSaving() const noexcept;
+		Status getStatus() const noexcept;
+		std::size_t getSavedGraphsCount() const noexcept;
+		std::size_t getGraphsCount() const noexcept;
+		const std::string& getErrorMessage() const noexcept;
+
+	private:
+		static GraphPointer makeSnapshotOf(const Graph& g);
+
+	private:
+		void takeSnapshotsOf(const std::vector<const Graph*>& graphs);
+		void saveSnapshots() noexcept;
+		void markSavedGraphsIn(GraphCollection& graphs) const;
+		void waitForWorker() noexcept;
+
+	private:
+		std::vector<Snapshot> snapshots;
+		FileFormat format;
+		std::size_t journalSize;
+		bool isStarted;
+		bool isFinished;
+		std::atomic<std::size_t> savedGraphsCount;
+		std::atomic<bool> isDoneSaving;
+		std::string errorMessage;
+		std::thread worker;
+	};
+}
+
+#endif //__BACKGROUND_SAVER_HEADER_INCLUDED__
\ No newline at end of file
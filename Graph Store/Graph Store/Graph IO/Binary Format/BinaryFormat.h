@@ -0,0 +1,85 @@
+#ifndef __BINARY_FORMAT_HEADER_INCLUDED__
+#define __BINARY_FORMAT_HEADER_INCLUDED__
+
+#include <cstdint>
+#include <cstddef>
+
+/*
+	Layout of a binary graph file (all numbers are little-endian):
+	
+	Header
+	std::uint64_t stringOffsets[verticesCount + 3]
+		- the graph id, the graph type and the vertex ids, in this order,
+		  followed by the size of the string pool
+	char stringPool[stringPoolSize]
+		- null-terminated strings, padded with zeroes to a multiple of 8
+	std::uint64_t edgeOffsets[verticesCount + 1]
+		- the edges leaving vertex i are [edgeOffsets[i], edgeOffsets[i + 1])
+	std::uint32_t edgeEnds[edgesCount]
+	std::uint32_t edgeWeights[edgesCount]
+	std::uint64_t checksum
+		- FNV-1a of all the preceding bytes
+
+	Every section starts at an offset that is a multiple of its alignment,
+	so a mapped file can be read in place.
+	In undirected graphs each edge is stored only once.
+*/
+
+namespace GraphIO
+{
+	namespace BinaryFormat
+	{
+		const char MAGIC[4] = { 'G', 'S', 'B', 'F' };
+		const std::uint32_t VERSION = 1;
+		const std::size_t ALIGNMENT = 8;
+
+		struct Header
+		{
+			char magic[4];
+			std::uint32_t version;
+			std::uint64_t verticesCount;
+			std::uint64_t edgesCount;
+			std::uint64_t stringPoolSize;
+		};
+
+		using Offset = std::uint64_t;
+		using VertexIndex = std::uint32_t;
+		using Weight = std::uint32_t;
+
+		inline std::size_t padToAlignment(std::size_t size) noexcept
+		{
+			return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+		}
+
+		class Checksum
+		{
+		public:
+			void update(const void* bytes, std::size_t count) noexcept
+			{
+				auto current = static_cast<const unsigned char*>(bytes);
+				auto end = current + count;
+
+				while (current != end)
+				{
+					value ^= *current;
+					value *= FNV_PRIME;
+					++current;
+				}
+			}
+
+			std::uint64_t getValue() const noexcept
+			{
+				return value;
+			}
+
+		private:
+			static const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+			static const std::uint64_t FNV_PRIME = 1099511628211ull;
+
+		private:
+			std::uint64_t value = FNV_OFFSET_BASIS;
+		};
+	}
+}
+
+#endif //__BINARY_FORMAT_HEADER_INCLUDED__
\ No newline at end of file
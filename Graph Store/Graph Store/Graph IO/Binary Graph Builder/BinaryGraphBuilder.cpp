@@ -0,0 +1,219 @@
+#include "BinaryGraphBuilder.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include "Graph IO/Exception.h"
+#include "Graph Factory/GraphFactory.h"
+#include "Invocer/Invocer.h"
+#include <cstring>
+
+namespace GraphIO
+{
+	std::unique_ptr<Graph>
+	BinaryGraphBuilder::buildFromFile(const String& fileName)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		openFile(fileName);
+		tryToReadOpenedFile(fileName, [this]() { buildAGraph(); });
+
+		return std::move(graph);
+	}
+
+	std::unique_ptr<Graph>
+	BinaryGraphBuilder::buildFrom(const char* data, std::size_t size)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		this->data = data;
+		this->size = size;
+		buildAGraph();
+
+		return std::move(graph);
+	}
+
+	String BinaryGraphBuilder::readIDOfGraphIn(const String& fileName)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		openFile(fileName);
+
+		return tryToReadOpenedFile(fileName, [this]()
+		{
+			verifyFileSize();
+			readHeader();
+			readStrings();
+
+			return String(getString(0));
+		});
+	}
+
+	void BinaryGraphBuilder::openFile(const String& name)
+	{
+		assert(!file.isOpen());
+
+		try
+		{
+			file.open(name);
+			data = file.getData();
+			size = file.getSize();
+		}
+		catch (OpenFileFailException& e)
+		{
+			throw Exception(String(e.what()));
+		}
+	}
+
+	void BinaryGraphBuilder::buildAGraph()
+	{
+		verifyFileSize();
+		verifyChecksum();
+		readHeader();
+		readStrings();
+		readEdges();
+		createEmptyGraph();
+		collectIdentifiers();
+		collectEdges();
+		graph->addVerticesAndEdges(identifiers, edges);
+	}
+
+	void BinaryGraphBuilder::verifyFileSize() const
+	{
+		verify(size >= sizeof(BinaryFormat::Header) + sizeof(std::uint64_t),
+			   "The file is too small to be a binary graph file!");
+	}
+
+	void BinaryGraphBuilder::verifyChecksum() const
+	{
+		auto contentSize = size - sizeof(std::uint64_t);
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(data, contentSize);
+		auto storedChecksum = std::uint64_t{};
+		std::memcpy(&storedChecksum, data + contentSize, sizeof(storedChecksum));
+
+		verify(checksum.getValue() == storedChecksum,
+			   "The checksum does not match, the file is corrupted!");
+	}
+
+	void BinaryGraphBuilder::readHeader()
+	{
+		position = data;
+		header = *take<BinaryFormat::Header>(1);
+
+		verify(std::memcmp(header.magic, BinaryFormat::MAGIC, sizeof(header.magic)) == 0,
+			   "This is not a binary graph file!");
+		verify(header.version == BinaryFormat::VERSION,
+			   "Unsupported binary graph file version!");
+		verify(header.verticesCount <= UINT32_MAX,
+			   "Too many vertices!");
+	}
+
+	void BinaryGraphBuilder::readStrings()
+	{
+		stringOffsets = take<BinaryFormat::Offset>(header.verticesCount + 3);
+		verify(header.stringPoolSize <= size, "Unexpected end of file!");
+		stringPool = take<char>(BinaryFormat::padToAlignment(header.stringPoolSize));
+		verifyStrings();
+	}
+
+	void BinaryGraphBuilder::readEdges()
+	{
+		edgeOffsets = take<BinaryFormat::Offset>(header.verticesCount + 1);
+		edgeEnds = take<BinaryFormat::VertexIndex>(header.edgesCount);
+		edgeWeights = take<BinaryFormat::Weight>(header.edgesCount);
+		take<char>(BinaryFormat::padToAlignment(2 * sizeof(std::uint32_t) * header.edgesCount)
+			       - 2 * sizeof(std::uint32_t) * header.edgesCount);
+		verifyEdges();
+
+		verify(position + sizeof(std::uint64_t) == data + size,
+			   "Unexpected data after the edges!");
+	}
+
+	void BinaryGraphBuilder::verifyStrings() const
+	{
+		auto stringsCount = header.verticesCount + 2;
+
+		verify(stringOffsets[0] == 0 && stringOffsets[stringsCount] == header.stringPoolSize,
+			   "Invalid string offsets!");
+
+		for (auto i = std::uint64_t{ 0 }; i < stringsCount; ++i)
+		{
+			verify(stringOffsets[i] < stringOffsets[i + 1]
+				   && stringOffsets[i + 1] <= header.stringPoolSize
+				   && stringPool[stringOffsets[i + 1] - 1] == '\0',
+				   "Invalid string offsets!");
+		}
+	}
+
+	void BinaryGraphBuilder::verifyEdges() const
+	{
+		verify(edgeOffsets[0] == 0 && edgeOffsets[header.verticesCount] == header.edgesCount,
+			   "Invalid edge offsets!");
+
+		for (auto i = std::uint64_t{ 0 }; i < header.verticesCount; ++i)
+		{
+			verify(edgeOffsets[i] <= edgeOffsets[i + 1], "Invalid edge offsets!");
+		}
+
+		for (auto i = std::uint64_t{ 0 }; i < header.edgesCount; ++i)
+		{
+			verify(edgeEnds[i] < header.verticesCount, "Invalid vertex index!");
+		}
+	}
+
+	void BinaryGraphBuilder::createEmptyGraph()
+	{
+		assert(graph == nullptr);
+
+		graph = GraphFactory::instance().createGraph(getString(1), getString(0));
+	}
+
+	void BinaryGraphBuilder::collectIdentifiers()
+	{
+		assert(identifiers.empty());
+
+		identifiers.reserve(static_cast<std::size_t>(header.verticesCount));
+
+		for (auto i = std::size_t{ 0 }; i < header.verticesCount; ++i)
+		{
+			identifiers.emplace_back(getString(i + 2));
+		}
+	}
+
+	void BinaryGraphBuilder::collectEdges()
+	{
+		assert(edges.empty());
+
+		edges.reserve(static_cast<std::size_t>(header.edgesCount));
+
+		for (auto i = std::size_t{ 0 }; i < header.verticesCount; ++i)
+		{
+			for (auto e = edgeOffsets[i]; e < edgeOffsets[i + 1]; ++e)
+			{
+				edges.push_back({ i, edgeEnds[e], edgeWeights[e] });
+			}
+		}
+	}
+
+	const char* BinaryGraphBuilder::getString(std::size_t index) const
+	{
+		return stringPool + stringOffsets[index];
+	}
+
+	void BinaryGraphBuilder::verify(bool condition, const char* message)
+	{
+		if (!condition)
+		{
+			throw Exception(String(message));
+		}
+	}
+
+	void BinaryGraphBuilder::releaseResources() noexcept
+	{
+		graph = nullptr;
+		identifiers.clear();
+		edges.clear();
+		file.close();
+		data = nullptr;
+		size = 0;
+		position = nullptr;
+	}
+}
\ No newline at end of file
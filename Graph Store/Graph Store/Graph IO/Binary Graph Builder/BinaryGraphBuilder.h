@@ -0,0 +1,94 @@
+#ifndef __BINARY_GRAPH_BUILDER_HEADER_INCLUDED__
+#define __BINARY_GRAPH_BUILDER_HEADER_INCLUDED__
+
+#include <memory>
+#include <vector>
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include "Graph IO/Exception.h"
+
+namespace GraphIO
+{
+	class BinaryGraphBuilder
+	{
+	public:
+		BinaryGraphBuilder() = default;
+		BinaryGraphBuilder(const BinaryGraphBuilder&) = delete;
+		BinaryGraphBuilder& operator=(const BinaryGraphBuilder&) = delete;
+
+		std::unique_ptr<Graph> buildFromFile(const String& fileName);
+		std::unique_ptr<Graph> buildFrom(const char* data, std::size_t size);
+		String readIDOfGraphIn(const String& fileName);
+
+	private:
+		static void verify(bool condition, const char* message);
+
+	private:
+		void openFile(const String& name);
+		template <class Function>
+		auto tryToReadOpenedFile(const String& fileName, Function read);
+		void buildAGraph();
+		void verifyFileSize() const;
+		void verifyChecksum() const;
+		void readHeader();
+		void readStrings();
+		void readEdges();
+		void verifyStrings() const;
+		void verifyEdges() const;
+		void createEmptyGraph();
+		void collectIdentifiers();
+		void collectEdges();
+		const char* getString(std::size_t index) const;
+		template <class T>
+		const T* take(std::uint64_t count);
+		void releaseResources() noexcept;
+
+	private:
+		MemoryMappedFile file;
+		const char* data = nullptr;
+		std::size_t size = 0;
+		const char* position = nullptr;
+		BinaryFormat::Header header = {};
+		const BinaryFormat::Offset* stringOffsets = nullptr;
+		const char* stringPool = nullptr;
+		const BinaryFormat::Offset* edgeOffsets = nullptr;
+		const BinaryFormat::VertexIndex* edgeEnds = nullptr;
+		const BinaryFormat::Weight* edgeWeights = nullptr;
+		std::unique_ptr<Graph> graph;
+		std::vector<String> identifiers;
+		std::vector<Graph::IndexedEdge> edges;
+	};
+
+	template <class Function>
+	auto BinaryGraphBuilder::tryToReadOpenedFile(const String& fileName,
+		                                         Function read)
+	{
+		assert(file.isOpen());
+
+		try
+		{
+			return read();
+		}
+		catch (std::exception& e)
+		{
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+
+	template <class T>
+	const T* BinaryGraphBuilder::take(std::uint64_t count)
+	{
+		auto end = data + size - sizeof(std::uint64_t);
+		auto available = static_cast<std::uint64_t>(end - position) / sizeof(T);
+
+		verify(count <= available, "Unexpected end of file!");
+
+		auto result = reinterpret_cast<const T*>(position);
+		position += count * sizeof(T);
+
+		return result;
+	}
+}
+
+#endif //__BINARY_GRAPH_BUILDER_HEADER_INCLUDED__
\ No newline at end of file
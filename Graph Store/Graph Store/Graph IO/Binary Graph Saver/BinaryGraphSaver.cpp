@@ -0,0 +1,234 @@
+#include "BinaryGraphSaver.h"
+#include "Graph IO/Exception.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Invocer/Invocer.h"
+#include <cstring>
+
+namespace GraphIO
+{
+	void BinaryGraphSaver::save(const Graph& g)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		collectVerticesOf(g);
+		collectEdgesOf(g);
+		openFileFor(g);
+		output = &file;
+		saveDecoratedGraph(g);
+		verifyNothingFailed();
+		replaceFile();
+	}
+
+	void BinaryGraphSaver::saveTo(const Graph& g, std::ostream& output)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		collectVerticesOf(g);
+		collectEdgesOf(g);
+		this->output = &output;
+		saveDecoratedGraph(g);
+	}
+
+	void BinaryGraphSaver::collectVerticesOf(const Graph& g)
+	{
+		assert(vertices.empty());
+
+		vertices.reserve(g.getVerticesCount());
+
+		auto iterator =
+			g.getConstIteratorOfVertices();
+
+		forEach(*iterator, [this](const auto& vertex)
+		{
+			vertices.push_back(&vertex);
+		});
+	}
+
+	void BinaryGraphSaver::collectEdgesOf(const Graph& g)
+	{
+		countEdgesLeavingEachVertexOf(g);
+		fillEdgesOf(g);
+	}
+
+	void BinaryGraphSaver::countEdgesLeavingEachVertexOf(const Graph& g)
+	{
+		edgeOffsets.assign(vertices.size() + 1, 0);
+
+		auto iterator =
+			g.getConstIteratorOfEdges();
+
+		forEach(*iterator, [this](const auto& edge)
+		{
+			++edgeOffsets[getIndexOf(edge.getStart()) + 1];
+		});
+
+		for (std::size_t i = 1; i < edgeOffsets.size(); ++i)
+		{
+			edgeOffsets[i] += edgeOffsets[i - 1];
+		}
+	}
+
+	void BinaryGraphSaver::fillEdgesOf(const Graph& g)
+	{
+		auto edgesCount = static_cast<std::size_t>(edgeOffsets.back());
+		edgeEnds.resize(edgesCount);
+		edgeWeights.resize(edgesCount);
+
+		auto nextPositions =
+			std::vector<BinaryFormat::Offset>(edgeOffsets.cbegin(), edgeOffsets.cend() - 1);
+		auto iterator =
+			g.getConstIteratorOfEdges();
+
+		forEach(*iterator, [&](const auto& edge)
+		{
+			auto& position = nextPositions[getIndexOf(edge.getStart())];
+
+			edgeEnds[position] = getIndexOf(edge.getEnd());
+			edgeWeights[position] = edge.getWeight();
+			++position;
+		});
+	}
+
+	void BinaryGraphSaver::openFileFor(const Graph& g)
+	{
+		assert(!file.is_open());
+
+		fileName = getBinaryFileNameFor(g.getID());
+		file.open(getTemporaryFileNameFor(fileName).cString(),
+			      std::ios::out | std::ios::trunc | std::ios::binary);
+		verifyFileIsOpen(fileName);
+	}
+
+	void BinaryGraphSaver::verifyFileIsOpen(const String& fileName) const
+	{
+		if (!file.is_open())
+		{
+			throw Exception("Could not open \"" + fileName + "\"!");
+		}
+	}
+
+	void BinaryGraphSaver::saveDecoratedGraph(const Graph& g)
+	{
+		saveHeaderOf(g);
+		saveStringsOf(g);
+		saveEdges();
+		saveChecksum();
+	}
+
+	void BinaryGraphSaver::saveHeaderOf(const Graph& g)
+	{
+		auto header = BinaryFormat::Header{};
+		std::memcpy(header.magic, BinaryFormat::MAGIC, sizeof(header.magic));
+		header.version = BinaryFormat::VERSION;
+		header.verticesCount = vertices.size();
+		header.edgesCount = edgeEnds.size();
+		header.stringPoolSize = std::strlen(g.getID().cString()) + 1
+			                    + std::strlen(g.getType().cString()) + 1;
+
+		std::for_each(vertices.cbegin(), vertices.cend(), [&header](const auto v)
+		{
+			header.stringPoolSize += std::strlen(v->getID().cString()) + 1;
+		});
+
+		write(&header, sizeof(header));
+	}
+
+	void BinaryGraphSaver::saveStringsOf(const Graph& g)
+	{
+		auto strings = std::vector<const char*>{ g.getID().cString(),
+			                                     g.getType().cString() };
+		strings.reserve(vertices.size() + 2);
+
+		std::for_each(vertices.cbegin(), vertices.cend(), [&strings](const auto v)
+		{
+			strings.push_back(v->getID().cString());
+		});
+
+		auto offsets = std::vector<BinaryFormat::Offset>{ 0 };
+		offsets.reserve(strings.size() + 1);
+
+		std::for_each(strings.cbegin(), strings.cend(), [&offsets](const char* s)
+		{
+			offsets.push_back(offsets.back() + std::strlen(s) + 1);
+		});
+
+		write(offsets);
+
+		std::for_each(strings.cbegin(), strings.cend(), [this](const char* s)
+		{
+			write(s, std::strlen(s) + 1);
+		});
+
+		writePaddingAfter(static_cast<std::size_t>(offsets.back()));
+	}
+
+	void BinaryGraphSaver::saveEdges()
+	{
+		write(edgeOffsets);
+		write(edgeEnds);
+		write(edgeWeights);
+		writePaddingAfter(edgeEnds.size() * sizeof(BinaryFormat::VertexIndex)
+			              + edgeWeights.size() * sizeof(BinaryFormat::Weight));
+	}
+
+	void BinaryGraphSaver::saveChecksum()
+	{
+		auto value = checksum.getValue();
+
+		output->write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void BinaryGraphSaver::write(const void* bytes, std::size_t count)
+	{
+		checksum.update(bytes, count);
+		output->write(static_cast<const char*>(bytes), count);
+	}
+
+	void BinaryGraphSaver::writePaddingAfter(std::size_t count)
+	{
+		const char zeroes[BinaryFormat::ALIGNMENT] = {};
+
+		write(zeroes, BinaryFormat::padToAlignment(count) - count);
+	}
+
+	void BinaryGraphSaver::verifyNothingFailed() const
+	{
+		if (!file)
+		{
+			throw Exception("Could not write \"" + fileName + "\"!");
+		}
+	}
+
+	BinaryFormat::VertexIndex
+	BinaryGraphSaver::getIndexOf(const Graph::Vertex& v) noexcept
+	{
+		return static_cast<BinaryFormat::VertexIndex>(v.getIndex());
+	}
+
+	/*
+		The graph is written to a temporary file which replaces the
+		previous one only once it is entirely written.
+	*/
+	void BinaryGraphSaver::replaceFile()
+	{
+		file.close();
+		verifyNothingFailed();
+		replaceWithTemporaryFile(fileName);
+	}
+
+	void BinaryGraphSaver::releaseResources() noexcept
+	{
+		if (output == &file)
+		{
+			file.close();
+			removeTemporaryFileFor(fileName);
+		}
+
+		output = nullptr;
+		checksum = BinaryFormat::Checksum{};
+		vertices.clear();
+		edgeOffsets.clear();
+		edgeEnds.clear();
+		edgeWeights.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef __BINARY_GRAPH_SAVER_HEADER_INCLUDED__
+#define __BINARY_GRAPH_SAVER_HEADER_INCLUDED__
+
+#include <fstream>
+#include <ostream>
+#include <vector>
+#include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+
+namespace GraphIO
+{
+	class BinaryGraphSaver
+	{
+	public:
+		BinaryGraphSaver() = default;
+		BinaryGraphSaver(const BinaryGraphSaver&) = delete;
+		BinaryGraphSaver& operator=(const BinaryGraphSaver&) = delete;
+
+		void save(const Graph& g);
+		void saveTo(const Graph& g, std::ostream& output);
+
+	private:
+		void collectVerticesOf(const Graph& g);
+		void collectEdgesOf(const Graph& g);
+		void countEdgesLeavingEachVertexOf(const Graph& g);
+		void fillEdgesOf(const Graph& g);
+		void openFileFor(const Graph& g);
+		void verifyFileIsOpen(const String& fileName) const;
+		void saveDecoratedGraph(const Graph& g);
+		void saveHeaderOf(const Graph& g);
+		void saveStringsOf(const Graph& g);
+		void saveEdges();
+		void saveChecksum();
+		void verifyNothingFailed() const;
+		void replaceFile();
+		template <class T>
+		void write(const std::vector<T>& items);
+		void write(const void* bytes, std::size_t count);
+		void writePaddingAfter(std::size_t count);
+		static BinaryFormat::VertexIndex getIndexOf(const Graph::Vertex& v) noexcept;
+		void releaseResources() noexcept;
+
+	private:
+		std::ofstream file;
+		std::ostream* output = nullptr;
+		String fileName;
+		BinaryFormat::Checksum checksum;
+		std::vector<const Graph::Vertex*> vertices;
+		std::vector<BinaryFormat::Offset> edgeOffsets;
+		std::vector<BinaryFormat::VertexIndex> edgeEnds;
+		std::vector<BinaryFormat::Weight> edgeWeights;
+	};
+
+	template <class T>
+	void BinaryGraphSaver::write(const std::vector<T>& items)
+	{
+		write(items.data(), items.size() * sizeof(T));
+	}
+}
+
+#endif //__BINARY_GRAPH_SAVER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef __CHECKPOINT_FORMAT_HEADER_INCLUDED__
+#define __CHECKPOINT_FORMAT_HEADER_INCLUDED__
+
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include <cstdint>
+
+/*
+	Layout of a checkpoint file (all numbers are little-endian):
+
+	Header
+	the graphs, each one stored as a binary graph file (see BinaryFormat.h)
+		padded with zeroes to a multiple of 8
+	Entry entries[graphsCount]
+	char ids[idsSize]
+		- the null-terminated graph ids, padded with zeroes to a multiple of 8
+	std::uint64_t checksum
+		- FNV-1a of the header, the entries and the ids
+
+	The id of the checkpoint is also logged in the journal, so the graphs
+	in the file are the ones from the moment that record was written.
+*/
+
+namespace GraphIO
+{
+	namespace CheckpointFormat
+	{
+		const char MAGIC[4] = { 'G', 'S', 'C', 'P' };
+		const std::uint32_t VERSION = 1;
+
+		struct Header
+		{
+			char magic[4];
+			std::uint32_t version;
+			std::uint64_t id;
+			std::uint64_t graphsCount;
+			std::uint64_t entriesOffset;
+			std::uint64_t idsSize;
+		};
+
+		struct Entry
+		{
+			std::uint64_t offset;
+			std::uint64_t size;
+			std::uint64_t idOffset;
+			std::uint64_t isModified;
+		};
+	}
+}
+
+#endif //__CHECKPOINT_FORMAT_HEADER_INCLUDED__
\ No newline at end of file
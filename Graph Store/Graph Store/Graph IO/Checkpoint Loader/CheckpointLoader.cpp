@@ -0,0 +1,247 @@
+#include "CheckpointLoader.h"
+#include "Graph IO/Binary Graph Builder/BinaryGraphBuilder.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Exception.h"
+#include "Graph Collection/GraphCollection.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace GraphIO
+{
+	std::weak_ptr<CheckpointLoader::Image> CheckpointLoader::loadedImage;
+
+	void CheckpointLoader::Image::open(const String& fileName)
+	{
+		file.open(fileName);
+	}
+
+	void CheckpointLoader::Image::copyToMemory()
+	{
+		auto lock = this->lock();
+
+		if (file.isOpen())
+		{
+			contents.assign(file.getData(), file.getData() + file.getSize());
+			file.close();
+		}
+	}
+
+	std::unique_lock<std::mutex> CheckpointLoader::Image::lock() const
+	{
+		return std::unique_lock<std::mutex>(mutex);
+	}
+
+	const char* CheckpointLoader::Image::getData() const noexcept
+	{
+		return file.isOpen() ? file.getData() : contents.data();
+	}
+
+	std::size_t CheckpointLoader::Image::getSize() const noexcept
+	{
+		return file.isOpen() ? file.getSize() : contents.size();
+	}
+
+	/*
+		Copies the loaded checkpoint to memory if any of its graphs is still
+		not loaded, so that the file is no longer open.
+	*/
+	void CheckpointLoader::releaseFile()
+	{
+		if (auto image = loadedImage.lock())
+		{
+			image->copyToMemory();
+		}
+	}
+
+	bool CheckpointLoader::isNewerThanTheGraphFilesIn(const String& directory,
+		                                              const String& fileName)
+	{
+		auto error = std::error_code{};
+		auto checkpointTime =
+			fs::last_write_time(fs::path(fileName.cString()), error);
+
+		if (error)
+		{
+			return false;
+		}
+
+		auto files = listGraphFilesIn(directory);
+
+		return std::all_of(files.cbegin(), files.cend(), [&](const String& file)
+		{
+			auto fileError = std::error_code{};
+			auto time = fs::last_write_time(fs::path(file.cString()), fileError);
+
+			return !fileError && time < checkpointTime;
+		});
+	}
+
+	void CheckpointLoader::open(const String& fileName)
+	{
+		this->fileName = fileName;
+		image = std::make_shared<Image>();
+
+		try
+		{
+			image->open(fileName);
+			readHeader();
+			readEntries();
+		}
+		catch (OpenFileFailException& e)
+		{
+			throw Exception(String(e.what()));
+		}
+		catch (std::exception& e)
+		{
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+
+	void CheckpointLoader::readHeader()
+	{
+		verify(image->getSize() >= sizeof(header) + sizeof(std::uint64_t),
+			   "The file is too small to be a checkpoint file!");
+
+		std::memcpy(&header, image->getData(), sizeof(header));
+
+		verify(std::memcmp(header.magic, CheckpointFormat::MAGIC, sizeof(header.magic)) == 0,
+			   "This is not a checkpoint file!");
+		verify(header.version == CheckpointFormat::VERSION,
+			   "Unsupported checkpoint file version!");
+	}
+
+	void CheckpointLoader::readEntries()
+	{
+		auto size = std::uint64_t{ image->getSize() };
+		auto end = size - sizeof(std::uint64_t);
+
+		verify(header.entriesOffset >= sizeof(header)
+			   && header.entriesOffset % BinaryFormat::ALIGNMENT == 0
+			   && header.entriesOffset <= end
+			   && header.graphsCount <= (end - header.entriesOffset) / sizeof(CheckpointFormat::Entry)
+			   && header.idsSize == end - header.entriesOffset
+			                        - header.graphsCount * sizeof(CheckpointFormat::Entry),
+			   "Invalid checkpoint layout!");
+
+		entries = reinterpret_cast<const CheckpointFormat::Entry*>(image->getData()
+			                                                       + header.entriesOffset);
+		ids = reinterpret_cast<const char*>(entries + header.graphsCount);
+
+		verifyChecksum();
+		verifyEntries();
+	}
+
+	void CheckpointLoader::verifyChecksum() const
+	{
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(&header, sizeof(header));
+		checksum.update(entries, header.graphsCount * sizeof(CheckpointFormat::Entry)
+			                     + header.idsSize);
+		auto storedChecksum = std::uint64_t{};
+		std::memcpy(&storedChecksum,
+			        image->getData() + image->getSize() - sizeof(storedChecksum),
+			        sizeof(storedChecksum));
+
+		verify(checksum.getValue() == storedChecksum,
+			   "The checksum does not match, the file is corrupted!");
+	}
+
+	void CheckpointLoader::verifyEntries() const
+	{
+		for (auto i = std::uint64_t{ 0 }; i < header.graphsCount; ++i)
+		{
+			const CheckpointFormat::Entry& entry = entries[i];
+
+			verify(entry.offset >= sizeof(header)
+				   && entry.offset % BinaryFormat::ALIGNMENT == 0
+				   && entry.offset <= header.entriesOffset
+				   && entry.size <= header.entriesOffset - entry.offset,
+				   "Invalid graph offsets!");
+			verify(entry.idOffset < header.idsSize
+				   && std::memchr(ids + entry.idOffset, '\0', header.idsSize - entry.idOffset) != nullptr,
+				   "Invalid graph id offsets!");
+		}
+	}
+
+	bool CheckpointLoader::findRecordIn(const Records& records,
+		                                std::size_t& position) const
+	{
+		auto id = String(std::to_string(header.id).c_str());
+
+		for (auto i = records.size(); i > 0; --i)
+		{
+			if (records[i - 1].type == Journal::RecordType::CHECKPOINT
+				&& records[i - 1].firstArgument == id)
+			{
+				position = i - 1;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	GraphCollection CheckpointLoader::load()
+	{
+		auto graphs = GraphCollection(static_cast<std::size_t>(header.graphsCount));
+
+		for (auto i = std::uint64_t{ 0 }; i < header.graphsCount; ++i)
+		{
+			const CheckpointFormat::Entry& entry = entries[i];
+
+			if (entry.isModified)
+			{
+				graphs.add(buildGraph(*image, entry, fileName));
+			}
+			else
+			{
+				graphs.addUnloaded(getIDOf(entry),
+					               [image = image, entry, fileName = fileName]()
+				{
+					return buildGraph(*image, entry, fileName);
+				});
+			}
+		}
+
+		loadedImage = image;
+
+		return graphs;
+	}
+
+	std::unique_ptr<Graph>
+	CheckpointLoader::buildGraph(const Image& image,
+		                         const CheckpointFormat::Entry& entry,
+		                         const String& fileName)
+	{
+		auto lock = image.lock();
+
+		try
+		{
+			return BinaryGraphBuilder().buildFrom(image.getData() + entry.offset,
+				                                  static_cast<std::size_t>(entry.size));
+		}
+		catch (std::exception& e)
+		{
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+
+	const char* CheckpointLoader::getIDOf(const CheckpointFormat::Entry& entry) const
+	{
+		return ids + entry.idOffset;
+	}
+
+	void CheckpointLoader::verify(bool condition, const char* message)
+	{
+		if (!condition)
+		{
+			throw Exception(String(message));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef __CHECKPOINT_LOADER_HEADER_INCLUDED__
+#define __CHECKPOINT_LOADER_HEADER_INCLUDED__
+
+#include "Graph IO/Checkpoint Format/CheckpointFormat.h"
+#include "Graph IO/Journal/Journal.h"
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include "String/String.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Graph;
+class GraphCollection;
+
+namespace GraphIO
+{
+	/*
+		Restores the graphs from a checkpoint file. The file stays mapped
+		while any of its graphs is not loaded: graphs that were not modified
+		when the checkpoint was made are loaded on first use, the others
+		are loaded right away so that they are saved by the next save.
+		A mapped file cannot be replaced on every platform, so the file is
+		copied to memory and released before a new checkpoint replaces it.
+	*/
+	class CheckpointLoader
+	{
+		using Records = std::vector<Journal::Record>;
+
+		class Image
+		{
+		public:
+			void open(const String& fileName);
+			void copyToMemory();
+			std::unique_lock<std::mutex> lock() const;
+
+			const char* getData() const noexcept;
+			std::size_t getSize() const noexcept;
+
+		private:
+			MemoryMappedFile file;
+			std::vector<char> contents;
+			mutable std::mutex mutex;
+		};
+
+	public:
+		static bool isNewerThanTheGraphFilesIn(const String& directory,
+			                                   const String& fileName);
+		static void releaseFile();
+
+	public:
+		CheckpointLoader() = default;
+		CheckpointLoader(const CheckpointLoader&) = delete;
+		CheckpointLoader& operator=(const CheckpointLoader&) = delete;
+
+		void open(const String& fileName);
+		bool findRecordIn(const Records& records, std::size_t& position) const;
+		GraphCollection load();
+
+	private:
+		static void verify(bool condition, const char* message);
+		static std::unique_ptr<Graph> buildGraph(const Image& image,
+			                                     const CheckpointFormat::Entry& entry,
+			                                     const String& fileName);
+
+	private:
+		void readHeader();
+		void readEntries();
+		void verifyChecksum() const;
+		void verifyEntries() const;
+		const char* getIDOf(const CheckpointFormat::Entry& entry) const;
+
+	private:
+		static std::weak_ptr<Image> loadedImage;
+
+	private:
+		std::shared_ptr<Image> image;
+		String fileName;
+		CheckpointFormat::Header header = {};
+		const CheckpointFormat::Entry* entries = nullptr;
+		const char* ids = nullptr;
+	};
+}
+
+#endif //__CHECKPOINT_LOADER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "CheckpointSaver.h"
+#include "Graph IO/Binary Graph Saver/BinaryGraphSaver.h"
+#include "Graph IO/Checkpoint Loader/CheckpointLoader.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Exception.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Invocer/Invocer.h"
+#include <chrono>
+#include <cstring>
+#include <random>
+
+namespace GraphIO
+{
+	std::uint64_t CheckpointSaver::save(const GraphCollection& graphs,
+		                                const String& fileName)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		this->fileName = fileName;
+		temporaryFileName = getTemporaryFileNameFor(fileName);
+
+		std::memcpy(header.magic, CheckpointFormat::MAGIC, sizeof(header.magic));
+		header.version = CheckpointFormat::VERSION;
+		header.id = generateID();
+
+		openTemporaryFile();
+		saveGraphsOf(graphs);
+		saveEntries();
+		saveHeader();
+		file.close();
+		verifyNothingFailed();
+		CheckpointLoader::releaseFile();
+		replaceWithTemporaryFile(fileName);
+
+		return header.id;
+	}
+
+	std::uint64_t CheckpointSaver::generateID()
+	{
+		auto device = std::random_device{};
+		auto time =
+			std::chrono::system_clock::now().time_since_epoch().count();
+
+		return (std::uint64_t{ device() } << 32)
+			   ^ std::uint64_t{ device() }
+			   ^ static_cast<std::uint64_t>(time);
+	}
+
+	void CheckpointSaver::openTemporaryFile()
+	{
+		file.open(temporaryFileName.cString(),
+			      std::ios::out | std::ios::trunc | std::ios::binary);
+
+		if (!file.is_open())
+		{
+			throw Exception("Could not open \"" + temporaryFileName + "\"!");
+		}
+
+		write(&header, sizeof(header));
+	}
+
+	void CheckpointSaver::saveGraphsOf(const GraphCollection& graphs)
+	{
+		graphs.forEachID([&](const String& id)
+		{
+			if (auto unloadedGraph = graphs.getUnloaded(id))
+			{
+				saveGraph(*unloadedGraph, false);
+			}
+			else
+			{
+				saveGraph(graphs[id], graphs.isModified(id));
+			}
+		});
+	}
+
+	void CheckpointSaver::saveGraph(const Graph& g, bool isModified)
+	{
+		auto entry = CheckpointFormat::Entry{};
+		entry.offset = static_cast<std::uint64_t>(file.tellp());
+		entry.idOffset = ids.size();
+		entry.isModified = isModified;
+
+		BinaryGraphSaver().saveTo(g, file);
+		verifyNothingFailed();
+
+		entry.size = static_cast<std::uint64_t>(file.tellp()) - entry.offset;
+		writePadding();
+		entries.push_back(entry);
+		ids.append(g.getID().cString());
+		ids.push_back('\0');
+	}
+
+	void CheckpointSaver::saveEntries()
+	{
+		header.graphsCount = entries.size();
+		header.entriesOffset = static_cast<std::uint64_t>(file.tellp());
+		ids.resize(BinaryFormat::padToAlignment(ids.size()), '\0');
+		header.idsSize = ids.size();
+
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(&header, sizeof(header));
+		checksum.update(entries.data(), entries.size() * sizeof(CheckpointFormat::Entry));
+		checksum.update(ids.data(), ids.size());
+		auto value = checksum.getValue();
+
+		write(entries.data(), entries.size() * sizeof(CheckpointFormat::Entry));
+		write(ids.data(), ids.size());
+		write(&value, sizeof(value));
+	}
+
+	void CheckpointSaver::saveHeader()
+	{
+		file.seekp(0);
+		write(&header, sizeof(header));
+	}
+
+	void CheckpointSaver::writePadding()
+	{
+		const char zeroes[BinaryFormat::ALIGNMENT] = {};
+		auto size = static_cast<std::size_t>(file.tellp());
+
+		write(zeroes, BinaryFormat::padToAlignment(size) - size);
+	}
+
+	void CheckpointSaver::write(const void* bytes, std::size_t count)
+	{
+		file.write(static_cast<const char*>(bytes), count);
+	}
+
+	void CheckpointSaver::verifyNothingFailed() const
+	{
+		if (!file)
+		{
+			throw Exception("Could not write \"" + temporaryFileName + "\"!");
+		}
+	}
+
+	void CheckpointSaver::releaseResources() noexcept
+	{
+		if (file.is_open())
+		{
+			file.close();
+		}
+
+		removeTemporaryFileFor(fileName);
+
+		header = {};
+		entries.clear();
+		ids.clear();
+	}
+}
\ No newline at end of file
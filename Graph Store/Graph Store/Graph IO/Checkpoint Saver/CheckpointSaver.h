@@ -0,0 +1,55 @@
+#ifndef __CHECKPOINT_SAVER_HEADER_INCLUDED__
+#define __CHECKPOINT_SAVER_HEADER_INCLUDED__
+
+#include "Graph IO/Checkpoint Format/CheckpointFormat.h"
+#include "String/String.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+class Graph;
+class GraphCollection;
+
+namespace GraphIO
+{
+	/*
+		Writes every graph of a collection into a single checkpoint file.
+		Graphs that are not loaded are read from their files and released
+		once they are written. The file is written under a temporary name,
+		synchronised with the disk and then renamed, so an interrupted
+		checkpoint leaves the previous one intact.
+	*/
+	class CheckpointSaver
+	{
+	public:
+		CheckpointSaver() = default;
+		CheckpointSaver(const CheckpointSaver&) = delete;
+		CheckpointSaver& operator=(const CheckpointSaver&) = delete;
+
+		std::uint64_t save(const GraphCollection& graphs, const String& fileName);
+
+	private:
+		static std::uint64_t generateID();
+
+	private:
+		void openTemporaryFile();
+		void saveGraphsOf(const GraphCollection& graphs);
+		void saveGraph(const Graph& g, bool isModified);
+		void saveEntries();
+		void saveHeader();
+		void writePadding();
+		void write(const void* bytes, std::size_t count);
+		void verifyNothingFailed() const;
+		void releaseResources() noexcept;
+
+	private:
+		std::ofstream file;
+		String fileName;
+		String temporaryFileName;
+		CheckpointFormat::Header header = {};
+		std::vector<CheckpointFormat::Entry> entries;
+		std::string ids;
+	};
+}
+
+#endif //__CHECKPOINT_SAVER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef __COMPRESSED_FORMAT_HEADER_INCLUDED__
+#define __COMPRESSED_FORMAT_HEADER_INCLUDED__
+
+#include <cstdint>
+#include <cstddef>
+
+/*
+	Layout of a compressed graph file:
+
+	char magic[4]
+	std::uint32_t version (little-endian)
+	varint verticesCount
+	varint edgesCount
+	the graph id, the graph type and the vertex ids, in this order,
+		each followed by a null character
+	for each vertex, in order of their indices:
+		varint degree
+		the indices of the end vertices in increasing order, the first one
+		as it is and every next one as its difference from the previous one
+		minus one
+		varint weights of the edges, in the same order
+	std::uint64_t checksum (little-endian)
+		- FNV-1a of all the preceding bytes
+
+	A varint stores seven bits of a number per byte, least significant
+	first, and sets the high bit of every byte except the last one.
+	In undirected graphs each edge is stored only once.
+*/
+
+namespace GraphIO
+{
+	namespace CompressedFormat
+	{
+		const char MAGIC[4] = { 'G', 'S', 'C', 'F' };
+		const std::uint32_t VERSION = 1;
+		const std::size_t MAX_VARINT_SIZE = 10;
+
+		inline char* encodeVarint(std::uint64_t number, char* destination) noexcept
+		{
+			while (number >= 0x80)
+			{
+				*destination++ = static_cast<char>((number & 0x7F) | 0x80);
+				number >>= 7;
+			}
+
+			*destination++ = static_cast<char>(number);
+
+			return destination;
+		}
+
+		inline bool decodeVarint(const char*& position,
+			                     const char* end,
+			                     std::uint64_t& number) noexcept
+		{
+			number = 0;
+
+			for (auto shift = 0u; position != end && shift < 64; shift += 7)
+			{
+				auto byte = static_cast<unsigned char>(*position++);
+				number |= std::uint64_t{ byte & 0x7Fu } << shift;
+
+				if ((byte & 0x80) == 0)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+}
+
+#endif //__COMPRESSED_FORMAT_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include "CompressedGraphBuilder.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include "Graph IO/Compressed Format/CompressedFormat.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include "Graph Factory/GraphFactory.h"
+#include "Invocer/Invocer.h"
+#include <cstring>
+
+namespace GraphIO
+{
+	namespace
+	{
+		const std::size_t MAGIC_AND_VERSION_SIZE = 8;
+		const std::size_t CHECKSUM_SIZE = 8;
+
+		std::uint64_t readLittleEndian(const char* bytes, std::size_t count) noexcept
+		{
+			auto number = std::uint64_t{ 0 };
+
+			for (auto i = std::size_t{ 0 }; i < count; ++i)
+			{
+				number |= std::uint64_t{ static_cast<unsigned char>(bytes[i]) } << (8 * i);
+			}
+
+			return number;
+		}
+	}
+
+	std::unique_ptr<Graph>
+	CompressedGraphBuilder::buildFromFile(const String& fileName)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		openFile(fileName);
+		tryToReadOpenedFile(fileName, [this]() { buildAGraph(); });
+
+		return std::move(graph);
+	}
+
+	String CompressedGraphBuilder::readIDOfGraphIn(const String& fileName)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		openFile(fileName);
+
+		return tryToReadOpenedFile(fileName, [this]()
+		{
+			verifyFileSize();
+			readHeader();
+
+			return String(readString());
+		});
+	}
+
+	void CompressedGraphBuilder::openFile(const String& name)
+	{
+		assert(!file.isOpen());
+
+		try
+		{
+			file.open(name);
+		}
+		catch (OpenFileFailException& e)
+		{
+			throw Exception(String(e.what()));
+		}
+	}
+
+	void CompressedGraphBuilder::buildAGraph()
+	{
+		verifyFileSize();
+		verifyChecksum();
+		readHeader();
+		createEmptyGraph();
+		readIdentifiers();
+		readEdges();
+
+		verify(position == end, "Unexpected data after the edges!");
+
+		graph->addVerticesAndEdges(identifiers, edges);
+	}
+
+	void CompressedGraphBuilder::verifyFileSize() const
+	{
+		verify(file.getSize() >= MAGIC_AND_VERSION_SIZE + CHECKSUM_SIZE,
+			   "The file is too small to be a compressed graph file!");
+	}
+
+	void CompressedGraphBuilder::verifyChecksum() const
+	{
+		auto contentSize = file.getSize() - CHECKSUM_SIZE;
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(file.getData(), contentSize);
+
+		verify(checksum.getValue() == readLittleEndian(file.getData() + contentSize, CHECKSUM_SIZE),
+			   "The checksum does not match, the file is corrupted!");
+	}
+
+	void CompressedGraphBuilder::readHeader()
+	{
+		position = file.getData();
+		end = file.getData() + file.getSize() - CHECKSUM_SIZE;
+
+		verify(std::memcmp(position, CompressedFormat::MAGIC, sizeof(CompressedFormat::MAGIC)) == 0,
+			   "This is not a compressed graph file!");
+		verify(readLittleEndian(position + sizeof(CompressedFormat::MAGIC), 4) == CompressedFormat::VERSION,
+			   "Unsupported compressed graph file version!");
+
+		position += MAGIC_AND_VERSION_SIZE;
+		verticesCount = readVarint();
+		edgesCount = readVarint();
+
+		verify(verticesCount <= UINT32_MAX && verticesCount <= getRemainingBytesCount(),
+			   "Too many vertices!");
+		verify(edgesCount <= getRemainingBytesCount(), "Too many edges!");
+	}
+
+	void CompressedGraphBuilder::createEmptyGraph()
+	{
+		assert(graph == nullptr);
+
+		auto id = readString();
+		auto type = readString();
+
+		graph = GraphFactory::instance().createGraph(type, id);
+	}
+
+	void CompressedGraphBuilder::readIdentifiers()
+	{
+		assert(identifiers.empty());
+
+		identifiers.reserve(static_cast<std::size_t>(verticesCount));
+
+		for (auto i = std::uint64_t{ 0 }; i < verticesCount; ++i)
+		{
+			identifiers.emplace_back(readString());
+		}
+	}
+
+	void CompressedGraphBuilder::readEdges()
+	{
+		assert(edges.empty());
+
+		edges.reserve(static_cast<std::size_t>(edgesCount));
+
+		for (auto i = std::size_t{ 0 }; i < verticesCount; ++i)
+		{
+			readEdgesLeaving(i);
+		}
+
+		verify(edges.size() == edgesCount, "The number of edges does not match!");
+	}
+
+	void CompressedGraphBuilder::readEdgesLeaving(std::size_t vertexIndex)
+	{
+		auto degree = readVarint();
+
+		verify(degree <= edgesCount - edges.size(), "The number of edges does not match!");
+
+		auto first = edges.size();
+
+		for (auto i = std::uint64_t{ 0 }; i < degree; ++i)
+		{
+			auto value = readVarint();
+			auto previousEnd = (i == 0) ? std::uint64_t{ 0 } : edges.back().endIndex + 1;
+
+			verify(value < verticesCount && previousEnd + value < verticesCount,
+				   "Invalid vertex index!");
+
+			edges.push_back({ vertexIndex, static_cast<std::size_t>(previousEnd + value), 0 });
+		}
+
+		for (auto e = first; e < edges.size(); ++e)
+		{
+			auto weight = readVarint();
+
+			verify(weight <= UINT32_MAX, "Invalid edge weight!");
+
+			edges[e].weight = static_cast<Graph::Edge::Weight>(weight);
+		}
+	}
+
+	const char* CompressedGraphBuilder::readString()
+	{
+		auto terminator =
+			static_cast<const char*>(std::memchr(position, '\0', getRemainingBytesCount()));
+
+		verify(terminator != nullptr, "Unexpected end of file!");
+
+		auto result = position;
+		position = terminator + 1;
+
+		return result;
+	}
+
+	std::uint64_t CompressedGraphBuilder::readVarint()
+	{
+		auto number = std::uint64_t{};
+
+		verify(CompressedFormat::decodeVarint(position, end, number),
+			   "Unexpected end of file!");
+
+		return number;
+	}
+
+	std::size_t CompressedGraphBuilder::getRemainingBytesCount() const noexcept
+	{
+		return static_cast<std::size_t>(end - position);
+	}
+
+	void CompressedGraphBuilder::verify(bool condition, const char* message)
+	{
+		if (!condition)
+		{
+			throw Exception(String(message));
+		}
+	}
+
+	void CompressedGraphBuilder::releaseResources() noexcept
+	{
+		graph = nullptr;
+		identifiers.clear();
+		edges.clear();
+		file.close();
+		position = nullptr;
+		end = nullptr;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef __COMPRESSED_GRAPH_BUILDER_HEADER_INCLUDED__
+#define __COMPRESSED_GRAPH_BUILDER_HEADER_INCLUDED__
+
+#include <memory>
+#include <vector>
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Exception.h"
+
+namespace GraphIO
+{
+	class CompressedGraphBuilder
+	{
+	public:
+		CompressedGraphBuilder() = default;
+		CompressedGraphBuilder(const CompressedGraphBuilder&) = delete;
+		CompressedGraphBuilder& operator=(const CompressedGraphBuilder&) = delete;
+
+		std::unique_ptr<Graph> buildFromFile(const String& fileName);
+		String readIDOfGraphIn(const String& fileName);
+
+	private:
+		static void verify(bool condition, const char* message);
+
+	private:
+		void openFile(const String& name);
+		template <class Function>
+		auto tryToReadOpenedFile(const String& fileName, Function read);
+		void buildAGraph();
+		void verifyFileSize() const;
+		void verifyChecksum() const;
+		void readHeader();
+		void createEmptyGraph();
+		void readIdentifiers();
+		void readEdges();
+		void readEdgesLeaving(std::size_t vertexIndex);
+		const char* readString();
+		std::uint64_t readVarint();
+		std::size_t getRemainingBytesCount() const noexcept;
+		void releaseResources() noexcept;
+
+	private:
+		MemoryMappedFile file;
+		const char* position = nullptr;
+		const char* end = nullptr;
+		std::uint64_t verticesCount = 0;
+		std::uint64_t edgesCount = 0;
+		std::unique_ptr<Graph> graph;
+		std::vector<String> identifiers;
+		std::vector<Graph::IndexedEdge> edges;
+	};
+
+	template <class Function>
+	auto CompressedGraphBuilder::tryToReadOpenedFile(const String& fileName,
+		                                             Function read)
+	{
+		assert(file.isOpen());
+
+		try
+		{
+			return read();
+		}
+		catch (std::exception& e)
+		{
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+}
+
+#endif //__COMPRESSED_GRAPH_BUILDER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "CompressedGraphSaver.h"
+#include "Graph IO/Compressed Format/CompressedFormat.h"
+#include "Graph IO/Exception.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Invocer/Invocer.h"
+#include <algorithm>
+
+namespace GraphIO
+{
+	void CompressedGraphSaver::save(const Graph& g)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		openFileFor(g);
+		collectEdgesOf(g);
+		saveGraph(g);
+		replaceFile();
+	}
+
+	void CompressedGraphSaver::collectEdgesOf(const Graph& g)
+	{
+		countEdgesLeavingEachVertexOf(g);
+		fillEdgesOf(g);
+		sortEdgesLeavingEachVertex();
+	}
+
+	void CompressedGraphSaver::countEdgesLeavingEachVertexOf(const Graph& g)
+	{
+		edgeOffsets.assign(g.getVerticesCount() + 1, 0);
+
+		auto iterator =
+			g.getConstIteratorOfEdges();
+
+		forEach(*iterator, [this](const auto& edge)
+		{
+			++edgeOffsets[edge.getStart().getIndex() + 1];
+		});
+
+		for (std::size_t i = 1; i < edgeOffsets.size(); ++i)
+		{
+			edgeOffsets[i] += edgeOffsets[i - 1];
+		}
+	}
+
+	void CompressedGraphSaver::fillEdgesOf(const Graph& g)
+	{
+		edges.resize(edgeOffsets.back());
+
+		auto nextPositions =
+			std::vector<std::size_t>(edgeOffsets.cbegin(), edgeOffsets.cend() - 1);
+		auto iterator =
+			g.getConstIteratorOfEdges();
+
+		forEach(*iterator, [&](const auto& edge)
+		{
+			auto& position = nextPositions[edge.getStart().getIndex()];
+
+			edges[position] = { edge.getEnd().getIndex(), edge.getWeight() };
+			++position;
+		});
+	}
+
+	void CompressedGraphSaver::sortEdgesLeavingEachVertex()
+	{
+		for (std::size_t i = 0; i + 1 < edgeOffsets.size(); ++i)
+		{
+			std::sort(edges.begin() + edgeOffsets[i],
+				      edges.begin() + edgeOffsets[i + 1]);
+		}
+	}
+
+	void CompressedGraphSaver::openFileFor(const Graph& g)
+	{
+		assert(!file.is_open());
+
+		fileName = getCompressedFileNameFor(g.getID());
+		file.open(getTemporaryFileNameFor(fileName).cString(),
+			      std::ios::out | std::ios::trunc | std::ios::binary);
+		verifyFileIsOpen();
+		buffer.reserve(BUFFER_SIZE + CompressedFormat::MAX_VARINT_SIZE);
+	}
+
+	void CompressedGraphSaver::verifyFileIsOpen() const
+	{
+		if (!file.is_open())
+		{
+			throw Exception("Could not open \"" + fileName + "\"!");
+		}
+	}
+
+	void CompressedGraphSaver::saveGraph(const Graph& g)
+	{
+		saveHeaderOf(g);
+		saveStringsOf(g);
+		saveEdges();
+		saveChecksum();
+		verifyNothingFailed();
+	}
+
+	void CompressedGraphSaver::saveHeaderOf(const Graph& g)
+	{
+		const char version[] = {
+			static_cast<char>(CompressedFormat::VERSION & 0xFF),
+			static_cast<char>((CompressedFormat::VERSION >> 8) & 0xFF),
+			static_cast<char>((CompressedFormat::VERSION >> 16) & 0xFF),
+			static_cast<char>((CompressedFormat::VERSION >> 24) & 0xFF)
+		};
+
+		write(CompressedFormat::MAGIC, sizeof(CompressedFormat::MAGIC));
+		write(version, sizeof(version));
+		writeVarint(g.getVerticesCount());
+		writeVarint(edges.size());
+	}
+
+	void CompressedGraphSaver::saveStringsOf(const Graph& g)
+	{
+		writeString(g.getID());
+		writeString(g.getType());
+
+		auto iterator =
+			g.getConstIteratorOfVertices();
+
+		forEach(*iterator, [this](const auto& vertex)
+		{
+			writeString(vertex.getID());
+		});
+	}
+
+	void CompressedGraphSaver::saveEdges()
+	{
+		for (std::size_t i = 0; i + 1 < edgeOffsets.size(); ++i)
+		{
+			saveEdgesLeaving(i);
+		}
+	}
+
+	void CompressedGraphSaver::saveEdgesLeaving(std::size_t vertexIndex)
+	{
+		auto begin = edges.cbegin() + edgeOffsets[vertexIndex];
+		auto end = edges.cbegin() + edgeOffsets[vertexIndex + 1];
+
+		writeVarint(end - begin);
+
+		for (auto edge = begin; edge != end; ++edge)
+		{
+			writeVarint(edge == begin ?
+				        edge->first :
+				        edge->first - (edge - 1)->first - 1);
+		}
+
+		for (auto edge = begin; edge != end; ++edge)
+		{
+			writeVarint(edge->second);
+		}
+	}
+
+	void CompressedGraphSaver::saveChecksum()
+	{
+		flushBuffer();
+
+		auto value = checksum.getValue();
+		char bytes[sizeof(value)];
+
+		for (std::size_t i = 0; i < sizeof(value); ++i)
+		{
+			bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+		}
+
+		file.write(bytes, sizeof(bytes));
+	}
+
+	void CompressedGraphSaver::writeString(const String& s)
+	{
+		write(s.cString(), s.getLength() + 1);
+	}
+
+	void CompressedGraphSaver::writeVarint(std::uint64_t number)
+	{
+		char bytes[CompressedFormat::MAX_VARINT_SIZE];
+		auto end = CompressedFormat::encodeVarint(number, bytes);
+
+		buffer.append(bytes, end);
+		flushBufferIfItIsFull();
+	}
+
+	void CompressedGraphSaver::write(const char* bytes, std::size_t count)
+	{
+		buffer.append(bytes, count);
+		flushBufferIfItIsFull();
+	}
+
+	void CompressedGraphSaver::flushBufferIfItIsFull()
+	{
+		if (buffer.size() >= BUFFER_SIZE)
+		{
+			flushBuffer();
+		}
+	}
+
+	void CompressedGraphSaver::flushBuffer()
+	{
+		checksum.update(buffer.data(), buffer.size());
+		file.write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+
+	void CompressedGraphSaver::verifyNothingFailed() const
+	{
+		if (!file)
+		{
+			throw Exception("Could not write \"" + fileName + "\"!");
+		}
+	}
+
+	/*
+		The graph is written to a temporary file which replaces the
+		previous one only once it is entirely written.
+	*/
+	void CompressedGraphSaver::replaceFile()
+	{
+		file.close();
+		verifyNothingFailed();
+		replaceWithTemporaryFile(fileName);
+	}
+
+	void CompressedGraphSaver::releaseResources() noexcept
+	{
+		file.close();
+		removeTemporaryFileFor(fileName);
+		checksum = BinaryFormat::Checksum{};
+		buffer.clear();
+		edgeOffsets.clear();
+		edges.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef __COMPRESSED_GRAPH_SAVER_HEADER_INCLUDED__
+#define __COMPRESSED_GRAPH_SAVER_HEADER_INCLUDED__
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+
+namespace GraphIO
+{
+	class CompressedGraphSaver
+	{
+		using OutgoingEdge = std::pair<std::size_t, Graph::Edge::Weight>;
+
+	public:
+		CompressedGraphSaver() = default;
+		CompressedGraphSaver(const CompressedGraphSaver&) = delete;
+		CompressedGraphSaver& operator=(const CompressedGraphSaver&) = delete;
+
+		void save(const Graph& g);
+
+	private:
+		void collectEdgesOf(const Graph& g);
+		void countEdgesLeavingEachVertexOf(const Graph& g);
+		void fillEdgesOf(const Graph& g);
+		void sortEdgesLeavingEachVertex();
+		void openFileFor(const Graph& g);
+		void verifyFileIsOpen() const;
+		void saveGraph(const Graph& g);
+		void saveHeaderOf(const Graph& g);
+		void saveStringsOf(const Graph& g);
+		void saveEdges();
+		void saveEdgesLeaving(std::size_t vertexIndex);
+		void saveChecksum();
+		void writeString(const String& s);
+		void writeVarint(std::uint64_t number);
+		void write(const char* bytes, std::size_t count);
+		void flushBufferIfItIsFull();
+		void flushBuffer();
+		void verifyNothingFailed() const;
+		void replaceFile();
+		void releaseResources() noexcept;
+
+	private:
+		static const std::size_t BUFFER_SIZE = 1 << 20;
+
+	private:
+		std::ofstream file;
+		String fileName;
+		BinaryFormat::Checksum checksum;
+		std::string buffer;
+		std::vector<std::size_t> edgeOffsets;
+		std::vector<OutgoingEdge> edges;
+	};
+}
+
+#endif //__COMPRESSED_GRAPH_SAVER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "ContentHash.h"
+#include "Graph/Abstract class/Graph.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include <cstring>
+#include <vector>
+
+namespace GraphIO
+{
+	namespace
+	{
+		std::uint64_t mix(std::uint64_t value) noexcept
+		{
+			value ^= value >> 30;
+			value *= 0xbf58476d1ce4e5b9ull;
+			value ^= value >> 27;
+			value *= 0x94d049bb133111ebull;
+			value ^= value >> 31;
+
+			return value;
+		}
+
+		std::uint64_t hash(const String& s) noexcept
+		{
+			auto checksum = BinaryFormat::Checksum{};
+			checksum.update(s.cString(), std::strlen(s.cString()));
+
+			return checksum.getValue();
+		}
+	}
+
+	std::uint64_t computeContentHashOf(const Graph& g)
+	{
+		auto vertexHashes = std::vector<std::uint64_t>(g.getVerticesCount());
+		auto result = mix(hash(g.getType()));
+		auto vertices = g.getConstIteratorOfVertices();
+
+		forEach(*vertices, [&](const Graph::Vertex& v)
+		{
+			vertexHashes[v.getIndex()] = mix(hash(v.getID()));
+			result += vertexHashes[v.getIndex()];
+		});
+
+		auto edges = g.getConstIteratorOfEdges();
+
+		forEach(*edges, [&](const Graph::Edge& e)
+		{
+			result += mix(vertexHashes[e.getStart().getIndex()]
+				          + mix(vertexHashes[e.getEnd().getIndex()] + e.getWeight()));
+		});
+
+		return result;
+	}
+}
\ No newline at end of file
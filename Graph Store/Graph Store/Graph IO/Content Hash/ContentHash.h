@@ -0,0 +1,18 @@
+#ifndef __CONTENT_HASH_HEADER_INCLUDED__
+#define __CONTENT_HASH_HEADER_INCLUDED__
+
+#include <cstdint>
+
+class Graph;
+
+namespace GraphIO
+{
+	/*
+		A hash of the type, the vertices and the edges of a graph. It does
+		not depend on the order in which they are stored, so a graph has
+		the same hash whatever file format it was loaded from.
+	*/
+	std::uint64_t computeContentHashOf(const Graph& g);
+}
+
+#endif //__CONTENT_HASH_HEADER_INCLUDED__
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "Graph Factory/GraphFactory.h"
 #include "Graph IO/GraphIOConstants.h"
 #include "Invocer/Invocer.h"
+#include "Parallel For/ParallelFor.h"
+#include <algorithm>
+#include <string>
 
 namespace GraphIO
 {
@@ -18,6 +21,22 @@ namespace GraphIO
 		return std::move(graph);
 	}
 
+	String GraphBuilder::readIDOfGraphIn(const String& fileName)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+		openFile(fileName);
+
+		try
+		{
+			return fileParser.readAndTrimLine();
+		}
+		catch (std::exception& e)
+		{
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+
 	void GraphBuilder::openFile(const String& name)
 	{
 		assert(!fileParser.hasOpenedFile());
@@ -49,8 +68,9 @@ namespace GraphIO
 	void GraphBuilder::buildAGraph()
 	{
 		createEmptyGraph();
-		addVerticesToTheCreatedGraph();
-		addEdgesHavingAddedVertices();
+		parseIdentifiers();
+		parseEdges();
+		graph->addVerticesAndEdges(identifiers, edges);
 	}
 
 	void GraphBuilder::createEmptyGraph()
@@ -63,71 +83,116 @@ namespace GraphIO
 		graph = GraphFactory::instance().createGraph(type, id);
 	}
 
-	void GraphBuilder::addVerticesToTheCreatedGraph()
+	void GraphBuilder::parseIdentifiers()
 	{
-		assert(graph != nullptr);
-		assert(identifiers.isEmpty());
+		assert(identifiers.empty());
 
-		auto identifiersCount = parseUnsignedAndSkipUntil('\n');
-		identifiers.ensureSize(identifiersCount);
+		auto identifiersCount = parseUnsignedAndSkipUntil(fileParser, '\n');
+		identifiers.reserve(identifiersCount);
 
 		for (auto i = 0u; i < identifiersCount; ++i)
 		{
-			identifiers.add(fileParser.readAndTrimLine());
-
-			graph->addVertex(identifiers[i]);
+			identifiers.push_back(fileParser.readAndTrimLine());
 		}
 	}
 
-	void GraphBuilder::addEdgesHavingAddedVertices()
+	void GraphBuilder::parseEdges()
 	{
-		assert(graph != nullptr);
+		assert(edges.empty());
 
-		auto edgesCount = parseUnsignedAndSkipUntil('\n');
+		auto edgesCount = parseUnsignedAndSkipUntil(fileParser, '\n');
+		auto parts =
+			fileParser.splitRemainderBefore(EDGE_START,
+			                                std::max<std::size_t>(getWorkersCountFor(edgesCount), 1),
+			                                MIN_PART_SIZE);
+		auto buffers = std::vector<EdgesBuffer>(parts.size());
+		auto errors = std::vector<std::exception_ptr>(parts.size());
 
-		for (auto i = 1u; i <= edgesCount; ++i)
+		parallelFor(parts.size(), [&](std::size_t i)
 		{
-			auto e = parseEdge();
-			addEdge(e);
+			try
+			{
+				parseEdgesFrom(parts[i], buffers[i]);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		});
+
+		mergeEdgesFrom(buffers, errors, edgesCount);
+	}
+
+	void GraphBuilder::parseEdgesFrom(TextRangeParser& part, EdgesBuffer& buffer)
+	{
+		while (part.skipUntil(EDGE_START))
+		{
+			buffer.push_back(parseEdgeFrom(part));
 		}
 	}
 
-	GraphBuilder::RawEdge GraphBuilder::parseEdge()
+	GraphBuilder::RawEdge GraphBuilder::parseEdgeFrom(TextRangeParser& parser)
 	{
 		auto edge = RawEdge();
 
-		fileParser.skipUntil(EDGE_START);
-		edge.startIDIndex = parseUnsignedAndSkipUntil(EDGE_ATTRIBUTE_SEPARATOR);
-		edge.endIDIndex = parseUnsignedAndSkipUntil(EDGE_ATTRIBUTE_SEPARATOR);
-		edge.weight = parseUnsignedAndSkipUntil(EDGE_END);
-		fileParser.skipUntil('\n');
+		edge.startIndex = parseUnsignedAndSkipUntil(parser, EDGE_ATTRIBUTE_SEPARATOR);
+		edge.endIndex = parseUnsignedAndSkipUntil(parser, EDGE_ATTRIBUTE_SEPARATOR);
+		edge.weight = parseUnsignedAndSkipUntil(parser, EDGE_END);
+		parser.skipUntil('\n');
 
 		return edge;
 	}
 
-	unsigned GraphBuilder::parseUnsignedAndSkipUntil(char c)
+	template <class Parser>
+	unsigned GraphBuilder::parseUnsignedAndSkipUntil(Parser& parser, char c)
 	{
-		auto result = fileParser.parseUnsigned();
-		fileParser.skipUntil(c);
+		auto result = parser.parseUnsigned();
+		parser.skipUntil(c);
 
 		return result;
 	}
 
-	void GraphBuilder::addEdge(const RawEdge& edge)
+	void GraphBuilder::mergeEdgesFrom(std::vector<EdgesBuffer>& buffers,
+		                              const std::vector<std::exception_ptr>& errors,
+		                              std::size_t edgesCount)
 	{
-		auto& startID = identifiers[edge.startIDIndex];
-		auto& endID = identifiers[edge.endIDIndex];
+		auto parsedEdgesCount = std::size_t{ 0 };
 
-		auto& start = graph->getVertexWithID(startID);
-		auto& end = graph->getVertexWithID(endID);
+		for (const auto& buffer : buffers)
+		{
+			parsedEdgesCount += buffer.size();
+		}
 
-		graph->addEdge(start, end, edge.weight);
+		edges.reserve(std::min(parsedEdgesCount, edgesCount));
+
+		for (auto i = std::size_t{ 0 }; i < buffers.size(); ++i)
+		{
+			auto count = std::min(buffers[i].size(), edgesCount - edges.size());
+			edges.insert(edges.end(), buffers[i].cbegin(), buffers[i].cbegin() + count);
+			buffers[i] = EdgesBuffer{};
+
+			if (edges.size() == edgesCount)
+			{
+				break;
+			}
+			else if (errors[i])
+			{
+				std::rethrow_exception(errors[i]);
+			}
+		}
+
+		if (edges.size() != edgesCount)
+		{
+			throw Exception("Expected " + std::to_string(edgesCount)
+				            + " edges but found " + std::to_string(edges.size()) + "!");
+		}
 	}
 
 	void GraphBuilder::releaseResources()
 	{
 		graph = nullptr;
-		identifiers.empty();
+		identifiers.clear();
+		edges.clear();
 		fileParser.closeFile();
 	}
 }
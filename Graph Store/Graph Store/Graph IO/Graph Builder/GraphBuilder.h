@@ -1,21 +1,18 @@
 #ifndef __GRAPH_BUILDER_HEADER_INCLUDED__
 #define __GRAPH_BUILDER_HEADER_INCLUDED__
 
-#include "File Parser/FileParser.h"
+#include "File Parser/Mapped File Parser/MappedFileParser.h"
 #include "String/String.h"
-#include "Dynamic Array/DynamicArray.h"
 #include "Graph/Abstract class/Graph.h"
+#include <exception>
+#include <vector>
 
 namespace GraphIO
 {
 	class GraphBuilder
 	{
-		struct RawEdge
-		{
-			std::size_t startIDIndex;
-			std::size_t endIDIndex;
-			Graph::Edge::Weight weight;
-		};
+		using RawEdge = Graph::IndexedEdge;
+		using EdgesBuffer = std::vector<RawEdge>;
 
 	public:
 		GraphBuilder() = default;
@@ -23,23 +20,34 @@ namespace GraphIO
 		GraphBuilder& operator=(const GraphBuilder&) = delete;
 
 		std::unique_ptr<Graph> buildFromFile(const String& fileName);
+		String readIDOfGraphIn(const String& fileName);
+
+	private:
+		static void parseEdgesFrom(TextRangeParser& part, EdgesBuffer& buffer);
+		static RawEdge parseEdgeFrom(TextRangeParser& parser);
+		template <class Parser>
+		static unsigned parseUnsignedAndSkipUntil(Parser& parser, char c);
 
 	private:
 		void openFile(const String& name);
 		void tryToBuildAGraphFromOpenedFile(const String& fileName);
 		void buildAGraph();
 		void createEmptyGraph();
-		void addVerticesToTheCreatedGraph();
-		void addEdgesHavingAddedVertices();
-		RawEdge parseEdge();
-		void addEdge(const RawEdge& e);
-		unsigned parseUnsignedAndSkipUntil(char c);
+		void parseIdentifiers();
+		void parseEdges();
+		void mergeEdgesFrom(std::vector<EdgesBuffer>& buffers,
+			                const std::vector<std::exception_ptr>& errors,
+			                std::size_t edgesCount);
 		void releaseResources();
 
+	private:
+		static const std::size_t MIN_PART_SIZE = 1 << 20;
+
 	private:
 		std::unique_ptr<Graph> graph;
-		DynamicArray<String> identifiers;
-		FileParser fileParser;
+		std::vector<String> identifiers;
+		EdgesBuffer edges;
+		MappedFileParser fileParser;
 	};
 
 }
@@ -0,0 +1,229 @@
+#include "GraphFileWatcher.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Content Hash/ContentHash.h"
+#include <exception>
+#include <assert.h>
+
+namespace fs = std::filesystem;
+
+namespace GraphIO
+{
+	GraphFileWatcher::GraphFileWatcher() noexcept :
+		interval(0),
+		isStopRequested(false)
+	{
+	}
+
+	GraphFileWatcher::~GraphFileWatcher()
+	{
+		stop();
+	}
+
+	void GraphFileWatcher::start(const String& directory, Interval interval)
+	{
+		assert(!isWatching());
+
+		this->directory = directory;
+		this->interval = interval;
+		watchFiles(getStatesOfFilesIn(directory));
+		isStopRequested = false;
+
+		worker = std::thread([this]() noexcept { watch(); });
+	}
+
+	void GraphFileWatcher::watchFiles(const FileStates& states)
+	{
+		watchedFiles.clear();
+		unstableFiles.clear();
+
+		for (const auto& file : states)
+		{
+			auto id = String{};
+
+			try
+			{
+				id = readIDOfGraphIn(file.first);
+			}
+			catch (std::exception&)
+			{
+			}
+
+			watchedFiles[file.first] = WatchedFile{ file.second, id };
+		}
+	}
+
+	void GraphFileWatcher::stop() noexcept
+	{
+		if (isWatching())
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(mutex);
+				isStopRequested = true;
+			}
+
+			stopCondition.notify_all();
+			worker.join();
+		}
+	}
+
+	bool GraphFileWatcher::isWatching() const noexcept
+	{
+		return worker.joinable();
+	}
+
+	std::vector<GraphFileWatcher::Change> GraphFileWatcher::takeChanges()
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+		auto result = std::move(changes);
+		changes.clear();
+
+		return result;
+	}
+
+	void GraphFileWatcher::watch() noexcept
+	{
+		while (waitForNextPoll())
+		{
+			try
+			{
+				poll();
+			}
+			catch (std::exception& e)
+			{
+				report(Change{ ChangeType::FAILED, directory, ""_s, nullptr, 0, e.what() });
+			}
+		}
+	}
+
+	bool GraphFileWatcher::waitForNextPoll()
+	{
+		auto lock = std::unique_lock<std::mutex>(mutex);
+
+		return !stopCondition.wait_for(lock, interval, [this]()
+		{
+			return isStopRequested;
+		});
+	}
+
+	void GraphFileWatcher::poll()
+	{
+		auto states = getStatesOfFilesIn(directory);
+
+		for (const auto& file : states)
+		{
+			const String& pathName = file.first;
+			const FileState& state = file.second;
+			auto watchedFile = watchedFiles.find(pathName);
+
+			if (watchedFile != watchedFiles.end()
+				&& areEqual(watchedFile->second.state, state))
+			{
+				unstableFiles.erase(pathName);
+				continue;
+			}
+
+			auto unstableFile = unstableFiles.find(pathName);
+
+			if (unstableFile != unstableFiles.end()
+				&& areEqual(unstableFile->second, state))
+			{
+				unstableFiles.erase(unstableFile);
+				rebuild(pathName, state);
+			}
+			else
+			{
+				unstableFiles[pathName] = state;
+			}
+		}
+
+		forgetRemovedFiles(states);
+	}
+
+	void GraphFileWatcher::rebuild(const String& pathName, const FileState& state)
+	{
+		auto change = Change{ ChangeType::UPDATED, getNameOf(pathName), ""_s, nullptr, 0, "" };
+
+		try
+		{
+			change.graph = buildFromFile(pathName);
+			change.graphID = change.graph->getID();
+			change.contentHash = computeContentHashOf(*change.graph);
+		}
+		catch (std::exception& e)
+		{
+			change.type = ChangeType::FAILED;
+			change.graph = nullptr;
+			change.errorMessage = e.what();
+		}
+
+		watchedFiles[pathName] = WatchedFile{ state, change.graphID };
+		report(std::move(change));
+	}
+
+	void GraphFileWatcher::forgetRemovedFiles(const FileStates& states)
+	{
+		for (auto file = watchedFiles.begin(); file != watchedFiles.end(); )
+		{
+			if (states.find(file->first) == states.end())
+			{
+				report(Change{ ChangeType::REMOVED, getNameOf(file->first),
+					           file->second.graphID, nullptr, 0, "" });
+				file = watchedFiles.erase(file);
+			}
+			else
+			{
+				++file;
+			}
+		}
+
+		for (auto file = unstableFiles.begin(); file != unstableFiles.end(); )
+		{
+			file = (states.find(file->first) == states.end()) ?
+				   unstableFiles.erase(file) :
+				   std::next(file);
+		}
+	}
+
+	void GraphFileWatcher::report(Change change)
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+		changes.push_back(std::move(change));
+	}
+
+	GraphFileWatcher::FileStates
+	GraphFileWatcher::getStatesOfFilesIn(const String& directory)
+	{
+		auto states = FileStates{};
+
+		for (const String& pathName : listGraphFilesIn(directory))
+		{
+			auto path = fs::path(pathName.cString());
+			auto error = std::error_code{};
+			auto state = FileState{ fs::last_write_time(path, error), 0 };
+
+			if (!error)
+			{
+				state.size = fs::file_size(path, error);
+			}
+
+			if (!error)
+			{
+				states[pathName] = state;
+			}
+		}
+
+		return states;
+	}
+
+	bool GraphFileWatcher::areEqual(const FileState& lhs,
+		                            const FileState& rhs) noexcept
+	{
+		return lhs.lastWriteTime == rhs.lastWriteTime
+			   && lhs.size == rhs.size;
+	}
+
+	String GraphFileWatcher::getNameOf(const String& pathName)
+	{
+		return String(fs::path(pathName.cString()).filename().string().c_str());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#ifndef __GRAPH_FILE_WATCHER_HEADER_INCLUDED__
+#define __GRAPH_FILE_WATCHER_HEADER_INCLUDED__
+
+#include "Graph/Abstract class/Graph.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GraphIO
+{
+	/*
+		Polls a directory for graph files that are added, changed or
+		removed by other programs and rebuilds the changed graphs on a
+		separate thread. A file is rebuilt only once it has stayed the same
+		for a whole polling interval, so files that are still being written
+		are not read. The changes are kept until they are taken.
+	*/
+	class GraphFileWatcher
+	{
+		using GraphPointer = std::unique_ptr<Graph>;
+
+	public:
+		using Interval = std::chrono::milliseconds;
+
+		enum class ChangeType
+		{
+			UPDATED,
+			REMOVED,
+			FAILED
+		};
+
+		struct Change
+		{
+			ChangeType type;
+			String fileName;
+			String graphID;
+			GraphPointer graph;
+			std::uint64_t contentHash;
+			std::string errorMessage;
+		};
+
+	private:
+		struct FileState
+		{
+			std::filesystem::file_time_type lastWriteTime;
+			std::uintmax_t size;
+		};
+
+		struct WatchedFile
+		{
+			FileState state;
+			String graphID;
+		};
+
+		using FileStates = std::map<String, FileState>;
+		using WatchedFiles = std::map<String, WatchedFile>;
+
+	public:
+		GraphFileWatcher() noexcept;
+		GraphFileWatcher(const GraphFileWatcher&) = delete;
+		GraphFileWatcher& operator=(const GraphFileWatcher&) = delete;
+		~GraphFileWatcher();
+
+		void start(const String& directory, Interval interval);
+		void stop() noexcept;
+		bool isWatching() const noexcept;
+		std::vector<Change> takeChanges();
+
+	private:
+		static FileStates getStatesOfFilesIn(const String& directory);
+		static bool areEqual(const FileState& lhs, const FileState& rhs) noexcept;
+		static String getNameOf(const String& pathName);
+
+	private:
+		void watchFiles(const FileStates& states);
+		void watch() noexcept;
+		bool waitForNextPoll();
+		void poll();
+		void rebuild(const String& pathName, const FileState& state);
+		void forgetRemovedFiles(const FileStates& states);
+		void report(Change change);
+
+	private:
+		String directory;
+		Interval interval;
+		WatchedFiles watchedFiles;
+		FileStates unstableFiles;
+		std::vector<Change> changes;
+		std::mutex mutex;
+		std::condition_variable stopCondition;
+		bool isStopRequested;
+		std::thread worker;
+	};
+}
+
+#endif //__GRAPH_FILE_WATCHER_HEADER_INCLUDED__
\ No newline at end of file
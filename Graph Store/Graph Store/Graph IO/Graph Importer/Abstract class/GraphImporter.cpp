@@ -0,0 +1,290 @@
+#include "GraphImporter.h"
+#include "Graph IO/Graph Importer/DIMACS Importer/DIMACSImporter.h"
+#include "Graph IO/Graph Importer/SNAP Importer/SNAPImporter.h"
+#include "Graph IO/Graph Importer/Matrix Market Importer/MatrixMarketImporter.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include "Graph IO/Exception.h"
+#include "Graph Factory/GraphFactory.h"
+#include "Invocer/Invocer.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace GraphIO
+{
+	std::unique_ptr<GraphImporter> GraphImporter::createFor(const String& format)
+	{
+		if (format == "dimacs"_s)
+		{
+			return std::make_unique<DIMACSImporter>();
+		}
+		else if (format == "snap"_s)
+		{
+			return std::make_unique<SNAPImporter>();
+		}
+		else if (format == "mtx"_s)
+		{
+			return std::make_unique<MatrixMarketImporter>();
+		}
+		else
+		{
+			throw Exception("Unknown import format: " + format);
+		}
+	}
+
+	std::unique_ptr<Graph> GraphImporter::importFrom(const String& fileName,
+		                                             const String& graphID)
+	{
+		auto resourceReleaser =
+			Invocer{ [this]() noexcept { releaseResources(); } };
+
+		try
+		{
+			file.open(fileName);
+		}
+		catch (OpenFileFailException& e)
+		{
+			throw Exception(String(e.what()));
+		}
+
+		try
+		{
+			parseLines();
+			finishParsing();
+			mergeDuplicateEdges();
+
+			return buildGraph(graphID);
+		}
+		catch (std::exception& e)
+		{
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+
+	void GraphImporter::parseLines()
+	{
+		auto position = file.getData();
+		auto end = position + file.getSize();
+
+		while (position != end)
+		{
+			auto endOfLine =
+				static_cast<const char*>(std::memchr(position, '\n', end - position));
+			auto lineEnd = (endOfLine != nullptr) ? endOfLine : end;
+			auto line = std::string_view(position, lineEnd - position);
+
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.remove_suffix(1);
+			}
+
+			++lineNumber;
+			parseLine(line);
+			position = (endOfLine != nullptr) ? endOfLine + 1 : end;
+		}
+	}
+
+	void GraphImporter::finishParsing()
+	{
+	}
+
+	/*
+		Sorting the keys with the indices of the edges keeps duplicates
+		together in the order in which they appear in the file.
+	*/
+	void GraphImporter::mergeDuplicateEdges()
+	{
+		using Key = std::pair<std::size_t, std::size_t>;
+
+		auto keys = std::vector<std::pair<Key, std::size_t>>{};
+		keys.reserve(edges.size());
+
+		for (auto i = std::size_t{ 0 }; i < edges.size(); ++i)
+		{
+			auto key = Key{ edges[i].startIndex, edges[i].endIndex };
+
+			if (isUndirected() && key.first > key.second)
+			{
+				std::swap(key.first, key.second);
+			}
+
+			keys.push_back({ key, i });
+		}
+
+		std::sort(keys.begin(), keys.end());
+		mergedEdgesCount = 0;
+		skippedLoopsCount = 0;
+
+		auto shouldBeSkipped = std::vector<bool>(edges.size(), false);
+		auto keptEdge = std::size_t{ 0 };
+
+		for (auto i = std::size_t{ 0 }; i < keys.size(); ++i)
+		{
+			const Key& key = keys[i].first;
+			auto edge = keys[i].second;
+
+			if (isUndirected() && key.first == key.second)
+			{
+				shouldBeSkipped[edge] = true;
+				++skippedLoopsCount;
+			}
+			else if (i > 0 && keys[i - 1].first == key)
+			{
+				edges[keptEdge].weight = std::min(edges[keptEdge].weight,
+					                              edges[edge].weight);
+				shouldBeSkipped[edge] = true;
+				++mergedEdgesCount;
+			}
+			else
+			{
+				keptEdge = edge;
+			}
+		}
+
+		auto keptEdgesCount = std::size_t{ 0 };
+
+		for (auto i = std::size_t{ 0 }; i < edges.size(); ++i)
+		{
+			if (!shouldBeSkipped[i])
+			{
+				edges[keptEdgesCount++] = edges[i];
+			}
+		}
+
+		edges.resize(keptEdgesCount);
+	}
+
+	std::unique_ptr<Graph> GraphImporter::buildGraph(const String& graphID) const
+	{
+		auto type = isUndirected() ? "undirected"_s : "directed"_s;
+		auto graph = GraphFactory::instance().createGraph(type, graphID);
+		graph->addVerticesAndEdges(identifiers, edges);
+
+		return graph;
+	}
+
+	void GraphImporter::addVertex(VertexID id)
+	{
+		getIndexOf(id);
+	}
+
+	void GraphImporter::addEdge(VertexID start,
+		                        VertexID end,
+		                        Graph::Edge::Weight weight)
+	{
+		auto startIndex = getIndexOf(start);
+		auto endIndex = getIndexOf(end);
+
+		edges.push_back({ startIndex, endIndex, weight });
+	}
+
+	std::size_t GraphImporter::getIndexOf(VertexID id)
+	{
+		auto result = indices.emplace(id, identifiers.size());
+
+		if (result.second)
+		{
+			identifiers.emplace_back(std::to_string(id).c_str());
+		}
+
+		return result.first->second;
+	}
+
+	void GraphImporter::reserveCapacityFor(std::uint64_t verticesCount,
+		                                   std::uint64_t edgesCount)
+	{
+		verify(verticesCount <= std::numeric_limits<std::uint32_t>::max(),
+			   "Too many vertices!");
+
+		indices.reserve(static_cast<std::size_t>(verticesCount));
+		identifiers.reserve(static_cast<std::size_t>(verticesCount));
+		edges.reserve(static_cast<std::size_t>(std::min(edgesCount,
+			                                            std::uint64_t{ MAX_RESERVED_EDGES_COUNT })));
+	}
+
+	void GraphImporter::makeUndirected() noexcept
+	{
+		isUndirectedGraph = true;
+	}
+
+	bool GraphImporter::isUndirected() const noexcept
+	{
+		return isUndirectedGraph;
+	}
+
+	std::size_t GraphImporter::getMergedEdgesCount() const noexcept
+	{
+		return mergedEdgesCount;
+	}
+
+	std::size_t GraphImporter::getSkippedLoopsCount() const noexcept
+	{
+		return skippedLoopsCount;
+	}
+
+	bool GraphImporter::startsWith(std::string_view line,
+		                           std::string_view prefix) noexcept
+	{
+		return line.substr(0, prefix.size()) == prefix;
+	}
+
+	void GraphImporter::splitIntoTokens(std::string_view line, Tokens& tokens)
+	{
+		const char* const WHITESPACE = " \t";
+
+		tokens.clear();
+		auto start = line.find_first_not_of(WHITESPACE);
+
+		while (start != std::string_view::npos)
+		{
+			auto end = line.find_first_of(WHITESPACE, start);
+			tokens.push_back(line.substr(start, end - start));
+			start = line.find_first_not_of(WHITESPACE, end);
+		}
+	}
+
+	std::uint64_t GraphImporter::parseNumber(std::string_view token) const
+	{
+		auto number = std::uint64_t{};
+		auto result =
+			std::from_chars(token.data(), token.data() + token.size(), number);
+
+		verify(result.ec == std::errc() && result.ptr == token.data() + token.size(),
+			   "Invalid number format!");
+
+		return number;
+	}
+
+	Graph::Edge::Weight GraphImporter::parseWeight(std::string_view token) const
+	{
+		verify(token.empty() || token.front() != '-',
+			   "Edge weights must not be negative!");
+
+		auto weight = parseNumber(token);
+
+		verify(weight <= std::numeric_limits<Graph::Edge::Weight>::max(),
+			   "Edge weight is too large!");
+
+		return static_cast<Graph::Edge::Weight>(weight);
+	}
+
+	void GraphImporter::verify(bool condition, const char* message) const
+	{
+		if (!condition)
+		{
+			throw Exception(message + " Error at line "_s
+				            + std::to_string(lineNumber).c_str());
+		}
+	}
+
+	void GraphImporter::releaseResources() noexcept
+	{
+		file.close();
+		lineNumber = 0;
+		indices.clear();
+		identifiers.clear();
+		edges.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef __GRAPH_IMPORTER_HEADER_INCLUDED__
+#define __GRAPH_IMPORTER_HEADER_INCLUDED__
+
+#include "Graph/Abstract class/Graph.h"
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace GraphIO
+{
+	/*
+		Builds a graph from an edge list in an external format. The file
+		is read in a single pass; the numeric vertex ids used in it are
+		mapped to dense vertices in order of their first appearance and
+		become the ids of the vertices. Duplicate edges are merged into the
+		first of them, which gets the lowest of their weights, and loops in
+		undirected graphs are skipped.
+	*/
+	class GraphImporter
+	{
+	public:
+		static std::unique_ptr<GraphImporter> createFor(const String& format);
+
+	public:
+		virtual ~GraphImporter() = default;
+
+		std::unique_ptr<Graph> importFrom(const String& fileName,
+			                              const String& graphID);
+		void makeUndirected() noexcept;
+		std::size_t getMergedEdgesCount() const noexcept;
+		std::size_t getSkippedLoopsCount() const noexcept;
+
+	protected:
+		using Tokens = std::vector<std::string_view>;
+		using VertexID = std::uint64_t;
+
+	protected:
+		static bool startsWith(std::string_view line, std::string_view prefix) noexcept;
+		static void splitIntoTokens(std::string_view line, Tokens& tokens);
+
+	protected:
+		GraphImporter() = default;
+		GraphImporter(const GraphImporter&) = delete;
+		GraphImporter& operator=(const GraphImporter&) = delete;
+
+		void addVertex(VertexID id);
+		void addEdge(VertexID start, VertexID end, Graph::Edge::Weight weight);
+		void reserveCapacityFor(std::uint64_t verticesCount, std::uint64_t edgesCount);
+		bool isUndirected() const noexcept;
+		std::uint64_t parseNumber(std::string_view token) const;
+		Graph::Edge::Weight parseWeight(std::string_view token) const;
+		void verify(bool condition, const char* message) const;
+
+	private:
+		virtual void parseLine(std::string_view line) = 0;
+		virtual void finishParsing();
+
+	private:
+		void parseLines();
+		std::size_t getIndexOf(VertexID id);
+		void mergeDuplicateEdges();
+		std::unique_ptr<Graph> buildGraph(const String& graphID) const;
+		void releaseResources() noexcept;
+
+	private:
+		static const std::size_t MAX_RESERVED_EDGES_COUNT = std::size_t{ 1 } << 26;
+
+	private:
+		MemoryMappedFile file;
+		unsigned lineNumber = 0;
+		bool isUndirectedGraph = false;
+		std::unordered_map<VertexID, std::size_t> indices;
+		std::vector<String> identifiers;
+		std::vector<Graph::IndexedEdge> edges;
+		std::size_t mergedEdgesCount = 0;
+		std::size_t skippedLoopsCount = 0;
+	};
+}
+
+#endif //__GRAPH_IMPORTER_HEADER_INCLUDED__
\ No newline at end of file
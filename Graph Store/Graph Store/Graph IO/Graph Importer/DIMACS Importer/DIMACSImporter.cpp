@@ -0,0 +1,78 @@
+#include "DIMACSImporter.h"
+#include "Graph IO/Exception.h"
+#include <string>
+
+namespace GraphIO
+{
+	void DIMACSImporter::parseLine(std::string_view line)
+	{
+		splitIntoTokens(line, tokens);
+
+		if (tokens.empty() || tokens[0] == "c")
+		{
+			return;
+		}
+		else if (tokens[0] == "p")
+		{
+			parseProblemLine();
+		}
+		else if (tokens[0] == "a")
+		{
+			parseArc();
+		}
+		else
+		{
+			verify(false, "Unknown line type!");
+		}
+	}
+
+	void DIMACSImporter::parseProblemLine()
+	{
+		verify(!hasReadProblemLine, "Duplicate problem line!");
+		verify(tokens.size() == 4 && tokens[1] == "sp",
+			   "Expected a problem line of the form: p sp <vertices> <arcs>");
+
+		verticesCount = parseNumber(tokens[2]);
+		arcsCount = parseNumber(tokens[3]);
+		hasReadProblemLine = true;
+		reserveCapacityFor(verticesCount, arcsCount);
+
+		for (auto id = VertexID{ 1 }; id <= verticesCount; ++id)
+		{
+			addVertex(id);
+		}
+	}
+
+	void DIMACSImporter::parseArc()
+	{
+		verify(hasReadProblemLine, "Expected the problem line before the arcs!");
+		verify(tokens.size() == 4, "Expected an arc of the form: a <start> <end> <weight>");
+
+		auto start = parseVertexID(tokens[1]);
+		auto end = parseVertexID(tokens[2]);
+		addEdge(start, end, parseWeight(tokens[3]));
+		++readArcsCount;
+	}
+
+	GraphImporter::VertexID DIMACSImporter::parseVertexID(std::string_view token) const
+	{
+		auto id = parseNumber(token);
+
+		verify(id >= 1 && id <= verticesCount, "Invalid vertex id!");
+
+		return id;
+	}
+
+	void DIMACSImporter::finishParsing()
+	{
+		if (!hasReadProblemLine)
+		{
+			throw Exception("The problem line is missing!"_s);
+		}
+		else if (readArcsCount != arcsCount)
+		{
+			throw Exception("Expected " + std::to_string(arcsCount)
+				            + " arcs but found " + std::to_string(readArcsCount) + "!");
+		}
+	}
+}
\ No newline at end of file
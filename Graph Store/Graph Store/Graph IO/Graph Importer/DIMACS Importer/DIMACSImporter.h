@@ -0,0 +1,36 @@
+#ifndef __DIMACS_IMPORTER_HEADER_INCLUDED__
+#define __DIMACS_IMPORTER_HEADER_INCLUDED__
+
+#include "Graph IO/Graph Importer/Abstract class/GraphImporter.h"
+
+namespace GraphIO
+{
+	/*
+		Imports shortest path problems in the DIMACS .gr format:
+		c <comment>
+		p sp <number of vertices> <number of arcs>
+		a <start> <end> <weight>
+		Vertices are numbered from 1.
+	*/
+	class DIMACSImporter : public GraphImporter
+	{
+	public:
+		DIMACSImporter() = default;
+
+	private:
+		void parseLine(std::string_view line) override;
+		void finishParsing() override;
+		void parseProblemLine();
+		void parseArc();
+		VertexID parseVertexID(std::string_view token) const;
+
+	private:
+		Tokens tokens;
+		bool hasReadProblemLine = false;
+		std::uint64_t verticesCount = 0;
+		std::uint64_t arcsCount = 0;
+		std::uint64_t readArcsCount = 0;
+	};
+}
+
+#endif //__DIMACS_IMPORTER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "MatrixMarketImporter.h"
+#include "Graph IO/Exception.h"
+#include <string>
+
+namespace GraphIO
+{
+	void MatrixMarketImporter::parseLine(std::string_view line)
+	{
+		if (!hasReadBanner)
+		{
+			splitIntoTokens(line, tokens);
+			parseBanner();
+			return;
+		}
+		else if (startsWith(line, "%"))
+		{
+			return;
+		}
+
+		splitIntoTokens(line, tokens);
+
+		if (tokens.empty())
+		{
+			return;
+		}
+		else if (!hasReadSize)
+		{
+			parseSize();
+		}
+		else
+		{
+			parseEntry();
+		}
+	}
+
+	void MatrixMarketImporter::parseBanner()
+	{
+		verify(tokens.size() == 5 && tokens[0] == "%%MatrixMarket" && tokens[1] == "matrix",
+			   "Expected a banner of the form: %%MatrixMarket matrix coordinate <field> <symmetry>");
+		verify(tokens[2] == "coordinate", "Only coordinate matrices can be imported!");
+		verify(tokens[3] == "pattern" || tokens[3] == "integer",
+			   "Only pattern and integer matrices can be imported!");
+		verify(tokens[4] == "general" || tokens[4] == "symmetric",
+			   "Only general and symmetric matrices can be imported!");
+
+		isPattern = (tokens[3] == "pattern");
+
+		if (tokens[4] == "symmetric")
+		{
+			makeUndirected();
+		}
+
+		hasReadBanner = true;
+	}
+
+	void MatrixMarketImporter::parseSize()
+	{
+		verify(tokens.size() == 3, "Expected a size line of the form: <rows> <columns> <entries>");
+
+		auto rowsCount = parseNumber(tokens[0]);
+		auto columnsCount = parseNumber(tokens[1]);
+
+		verify(rowsCount == columnsCount, "Only square matrices can be imported!");
+
+		verticesCount = rowsCount;
+		entriesCount = parseNumber(tokens[2]);
+		hasReadSize = true;
+		reserveCapacityFor(verticesCount, entriesCount);
+
+		for (auto id = VertexID{ 1 }; id <= verticesCount; ++id)
+		{
+			addVertex(id);
+		}
+	}
+
+	void MatrixMarketImporter::parseEntry()
+	{
+		verify(tokens.size() == (isPattern ? 2 : 3),
+			   isPattern ?
+			   "Expected an entry of the form: <row> <column>" :
+			   "Expected an entry of the form: <row> <column> <value>");
+
+		auto start = parseVertexID(tokens[0]);
+		auto end = parseVertexID(tokens[1]);
+		auto weight = isPattern ? PATTERN_EDGE_WEIGHT : parseWeight(tokens[2]);
+
+		addEdge(start, end, weight);
+		++readEntriesCount;
+	}
+
+	GraphImporter::VertexID
+	MatrixMarketImporter::parseVertexID(std::string_view token) const
+	{
+		auto id = parseNumber(token);
+
+		verify(id >= 1 && id <= verticesCount, "Invalid row or column index!");
+
+		return id;
+	}
+
+	void MatrixMarketImporter::finishParsing()
+	{
+		if (!hasReadBanner || !hasReadSize)
+		{
+			throw Exception("The banner or the size line is missing!"_s);
+		}
+		else if (readEntriesCount != entriesCount)
+		{
+			throw Exception("Expected " + std::to_string(entriesCount)
+				            + " entries but found " + std::to_string(readEntriesCount) + "!");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef __MATRIX_MARKET_IMPORTER_HEADER_INCLUDED__
+#define __MATRIX_MARKET_IMPORTER_HEADER_INCLUDED__
+
+#include "Graph IO/Graph Importer/Abstract class/GraphImporter.h"
+
+namespace GraphIO
+{
+	/*
+		Imports square sparse matrices in the Matrix Market coordinate
+		format as adjacency matrices. Pattern matrices give edges with a
+		weight of 1, integer matrices use the entries as weights and
+		symmetric matrices give undirected graphs. Rows and columns are
+		numbered from 1.
+	*/
+	class MatrixMarketImporter : public GraphImporter
+	{
+	public:
+		MatrixMarketImporter() = default;
+
+	private:
+		void parseLine(std::string_view line) override;
+		void finishParsing() override;
+		void parseBanner();
+		void parseSize();
+		void parseEntry();
+		VertexID parseVertexID(std::string_view token) const;
+
+	private:
+		static const Graph::Edge::Weight PATTERN_EDGE_WEIGHT = 1;
+
+	private:
+		Tokens tokens;
+		bool hasReadBanner = false;
+		bool hasReadSize = false;
+		bool isPattern = false;
+		std::uint64_t verticesCount = 0;
+		std::uint64_t entriesCount = 0;
+		std::uint64_t readEntriesCount = 0;
+	};
+}
+
+#endif //__MATRIX_MARKET_IMPORTER_HEADER_INCLUDED__
\ No newline at end of file
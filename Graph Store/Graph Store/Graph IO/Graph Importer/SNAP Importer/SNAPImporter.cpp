@@ -0,0 +1,29 @@
+#include "SNAPImporter.h"
+
+namespace GraphIO
+{
+	void SNAPImporter::parseLine(std::string_view line)
+	{
+		if (startsWith(line, "#"))
+		{
+			return;
+		}
+
+		splitIntoTokens(line, tokens);
+
+		if (tokens.empty())
+		{
+			return;
+		}
+
+		verify(tokens.size() == 2 || tokens.size() == 3,
+			   "Expected two vertex ids and an optional weight!");
+
+		auto start = parseNumber(tokens[0]);
+		auto end = parseNumber(tokens[1]);
+		auto weight =
+			(tokens.size() == 3) ? parseWeight(tokens[2]) : DEFAULT_EDGE_WEIGHT;
+
+		addEdge(start, end, weight);
+	}
+}
\ No newline at end of file
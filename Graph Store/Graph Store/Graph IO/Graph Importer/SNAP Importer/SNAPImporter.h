@@ -0,0 +1,30 @@
+#ifndef __SNAP_IMPORTER_HEADER_INCLUDED__
+#define __SNAP_IMPORTER_HEADER_INCLUDED__
+
+#include "Graph IO/Graph Importer/Abstract class/GraphImporter.h"
+
+namespace GraphIO
+{
+	/*
+		Imports SNAP edge lists: lines starting with # are comments and
+		every other line holds the ids of the start and end vertex of an
+		edge, separated by whitespace, optionally followed by its weight.
+		Edges without a weight get a weight of 1.
+	*/
+	class SNAPImporter : public GraphImporter
+	{
+	public:
+		SNAPImporter() = default;
+
+	private:
+		void parseLine(std::string_view line) override;
+
+	private:
+		static const Graph::Edge::Weight DEFAULT_EDGE_WEIGHT = 1;
+
+	private:
+		Tokens tokens;
+	};
+}
+
+#endif //__SNAP_IMPORTER_HEADER_INCLUDED__
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "Graph IO/GraphIOConstants.h"
 #include "Graph IO/GraphFilesFunctions.h"
 #include "Invocer/Invocer.h"
+#include <charconv>
+#include <limits>
 
 namespace GraphIO
 {
@@ -10,39 +12,23 @@ namespace GraphIO
 	{
 		auto resourceReleaser =
 			Invocer{ [this]() noexcept { releaseResources(); } };
-		decorateVerticesOf(g);
 		openFileFor(g);
-		saveDecoratedGraph(g);
-	}
-
-	void GraphSaver::decorateVerticesOf(const Graph& g)
-	{
-		assert(decoratedVertices.empty());
-		assert(!file.is_open());
-
-		decoratedVertices.reserve(g.getVerticesCount());
-
-		auto iterator =
-			g.getConstIteratorOfVertices();
-		auto index = 0u;
-
-		forEach(*iterator, [&](const auto& vertex)
-		{
-			decoratedVertices.emplace(vertex.getID(), index);
-			++index;
-		});
+		saveGraph(g);
+		replaceFile();
 	}
 
 	void GraphSaver::openFileFor(const Graph& g)
 	{
 		assert(!file.is_open());
 
-		auto name = getFileNameFor(g);
-		file.open(name.cString(), std::ios::out | std::ios::trunc);
-		verifyFileIsOpen(name);
+		fileName = getFileNameFor(g.getID());
+		file.open(getTemporaryFileNameFor(fileName).cString(),
+			      std::ios::out | std::ios::trunc);
+		verifyFileIsOpen();
+		buffer.reserve(BUFFER_SIZE);
 	}
 
-	void GraphSaver::verifyFileIsOpen(const String& fileName) const
+	void GraphSaver::verifyFileIsOpen() const
 	{
 		if (!file.is_open())
 		{
@@ -50,56 +36,120 @@ namespace GraphIO
 		}
 	}
 
-	void GraphSaver::saveDecoratedGraph(const Graph& g)
+	void GraphSaver::saveGraph(const Graph& g)
 	{
 		saveIDAndTypeOf(g);
 		saveVerticesOf(g);
 		saveEdgesOf(g);
+		flushBuffer();
+		verifyNothingFailed();
 	}
 
 	void GraphSaver::saveIDAndTypeOf(const Graph& g)
 	{
-		file << g.getID() << '\n'
-			 << g.getType() << '\n';
+		writeLine(g.getID());
+		writeLine(g.getType());
 	}
 
 	void GraphSaver::saveVerticesOf(const Graph& g)
 	{
-		file << g.getVerticesCount() << '\n';
+		writeLine(g.getVerticesCount());
 
 		auto iterator =
 			g.getConstIteratorOfVertices();
 
-		forEach(*iterator, [&](const auto& vertex)
+		forEach(*iterator, [this](const auto& vertex)
 		{
-			file << vertex.getID() << '\n';
+			writeLine(vertex.getID());
 		});
 	}
 
 	void GraphSaver::saveEdgesOf(const Graph& g)
 	{
-		file << g.getEdgesCount() << '\n';
+		writeLine(g.getEdgesCount());
 
 		auto iterator =
 			g.getConstIteratorOfEdges();
 
-		forEach(*iterator, [&](const auto& edge)
+		forEach(*iterator, [this](const auto& edge)
 		{
-			file << EDGE_START << getIndexOf(edge.getStart())
-				 << EDGE_ATTRIBUTE_SEPARATOR << getIndexOf(edge.getEnd())
-				 << EDGE_ATTRIBUTE_SEPARATOR << edge.getWeight()
-				 << EDGE_END << '\n';
+			write(EDGE_START);
+			write(edge.getStart().getIndex());
+			write(EDGE_ATTRIBUTE_SEPARATOR);
+			write(edge.getEnd().getIndex());
+			write(EDGE_ATTRIBUTE_SEPARATOR);
+			write(std::size_t{ edge.getWeight() });
+			write(EDGE_END);
+			write('\n');
+			flushBufferIfItIsFull();
 		});
 	}
 
-	std::size_t GraphSaver::getIndexOf(const Graph::Vertex& v) const
+	void GraphSaver::writeLine(const String& s)
+	{
+		buffer.append(s.cString(), s.getLength());
+		write('\n');
+		flushBufferIfItIsFull();
+	}
+
+	void GraphSaver::writeLine(std::size_t number)
+	{
+		write(number);
+		write('\n');
+		flushBufferIfItIsFull();
+	}
+
+	void GraphSaver::write(std::size_t number)
+	{
+		char digits[std::numeric_limits<std::size_t>::digits10 + 1];
+		auto result =
+			std::to_chars(digits, digits + sizeof(digits), number);
+
+		buffer.append(digits, result.ptr);
+	}
+
+	void GraphSaver::write(char c)
+	{
+		buffer.push_back(c);
+	}
+
+	void GraphSaver::flushBufferIfItIsFull()
+	{
+		if (buffer.size() >= BUFFER_SIZE)
+		{
+			flushBuffer();
+		}
+	}
+
+	void GraphSaver::flushBuffer()
 	{
-		return decoratedVertices.at(v.getID());
+		file.write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+
+	void GraphSaver::verifyNothingFailed() const
+	{
+		if (!file)
+		{
+			throw Exception("Could not write \"" + fileName + "\"!");
+		}
+	}
+
+	/*
+		The graph is written to a temporary file which replaces the
+		previous one only once it is entirely written.
+	*/
+	void GraphSaver::replaceFile()
+	{
+		file.close();
+		verifyNothingFailed();
+		replaceWithTemporaryFile(fileName);
 	}
 
-	void GraphSaver::releaseResources()
+	void GraphSaver::releaseResources() noexcept
 	{
 		file.close();
-		decoratedVertices.clear();
+		removeTemporaryFileFor(fileName);
+		buffer.clear();
 	}
-}
+}
\ No newline at end of file
@@ -2,34 +2,44 @@
 #define __GRAPH_SAVER_HEADER_INCLUDED__
 
 #include <fstream>
-#include <unordered_map>
-#include "Hash/Hash Function/HashFunction.h"
+#include <string>
 #include "Graph/Abstract class/Graph.h"
 
 namespace GraphIO
 {
 	class GraphSaver
 	{
-		using VertexID = String;
-		using Map = std::unordered_map<std::reference_wrapper<const VertexID>, std::size_t, HashFunction<VertexID>>;
-
 	public:
+		GraphSaver() = default;
+		GraphSaver(const GraphSaver&) = delete;
+		GraphSaver& operator=(const GraphSaver&) = delete;
+
 		void save(const Graph& g);
 
 	private:
-		void decorateVerticesOf(const Graph& g);
 		void openFileFor(const Graph& g);
-		void verifyFileIsOpen(const String& fileName) const;
-		void saveDecoratedGraph(const Graph& g);
+		void verifyFileIsOpen() const;
+		void saveGraph(const Graph& g);
 		void saveIDAndTypeOf(const Graph& g);
 		void saveVerticesOf(const Graph& g);
 		void saveEdgesOf(const Graph& g);
-		std::size_t getIndexOf(const Graph::Vertex& v) const;
-		void releaseResources();
+		void writeLine(const String& s);
+		void writeLine(std::size_t number);
+		void write(std::size_t number);
+		void write(char c);
+		void flushBufferIfItIsFull();
+		void flushBuffer();
+		void verifyNothingFailed() const;
+		void replaceFile();
+		void releaseResources() noexcept;
+
+	private:
+		static const std::size_t BUFFER_SIZE = 1 << 20;
 
 	private:
 		std::ofstream file;
-		Map decoratedVertices;
+		String fileName;
+		std::string buffer;
 	};
 }
 
@@ -3,41 +3,188 @@
 #include "String/String.h"
 #include "Graph Collection/GraphCollection.h"
 #include "Graph IO/Graph Builder/GraphBuilder.h"
+#include "Graph IO/Binary Graph Builder/BinaryGraphBuilder.h"
+#include "Graph IO/Compressed Graph Builder/CompressedGraphBuilder.h"
+#include "Graph IO/Graph Saver/GraphSaver.h"
+#include "Graph IO/Binary Graph Saver/BinaryGraphSaver.h"
+#include "Graph IO/Compressed Graph Saver/CompressedGraphSaver.h"
 #include "Directory Iterator/DirectoryIterator.h"
 #include "Directory Iterator/ExtensionFilter.h"
 #include "Graph IO/Exception.h"
 #include "Graph IO/GraphIOConstants.h"
+#include "Parallel For/ParallelFor.h"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
 #include <filesystem>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace fs = std::filesystem;
 
 namespace GraphIO
 {
+	void removeFileIfItExists(const String& name);
 	void tryToRemoveExistingFile(const fs::path& name);
+	FileFormat getFormatOf(const String& pathName);
+	void synchroniseWithDisk(const String& fileName);
+
+	const FileFormat FILE_FORMATS[] = { FileFormat::TEXT,
+	                                    FileFormat::BINARY,
+	                                    FileFormat::COMPRESSED };
 
 	GraphCollection loadDirectory(const String& path)
 	{
+		auto files = listGraphFilesIn(path);
+		auto ids = std::vector<String>(files.size());
+		auto errors = std::vector<std::exception_ptr>(files.size());
+
+		parallelFor(files.size(), [&](std::size_t i)
+		{
+			try
+			{
+				ids[i] = readIDOfGraphIn(files[i]);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		});
+
 		auto graphs = GraphCollection();
-		auto builder = GraphBuilder();
+
+		for (auto i = std::size_t{ 0 }; i < files.size(); ++i)
+		{
+			if (errors[i])
+			{
+				std::rethrow_exception(errors[i]);
+			}
+
+			graphs.addUnloaded(ids[i], [file = files[i]]()
+			{
+				return buildFromFile(file);
+			});
+		}
+
+		return graphs;
+	}
+
+	std::vector<String> listGraphFilesIn(const String& path)
+	{
+		auto files = std::vector<String>{};
 		auto iterator =
-			DirectoryIterator(path, ExtensionFilter(FILE_EXTENSION));
+			DirectoryIterator(path, ExtensionFilter{ FILE_EXTENSION,
+			                                         BINARY_FILE_EXTENSION,
+			                                         COMPRESSED_FILE_EXTENSION });
+
+		forEach(iterator, [&files](const auto& pathName)
+		{
+			files.push_back(pathName);
+		});
+
+		std::sort(files.begin(), files.end());
+
+		return files;
+	}
+
+	String readIDOfGraphIn(const String& pathName)
+	{
+		switch (getFormatOf(pathName))
+		{
+		case FileFormat::BINARY:
+			return BinaryGraphBuilder().readIDOfGraphIn(pathName);
+		case FileFormat::COMPRESSED:
+			return CompressedGraphBuilder().readIDOfGraphIn(pathName);
+		default:
+			return GraphBuilder().readIDOfGraphIn(pathName);
+		}
+	}
+
+	std::unique_ptr<Graph> buildFromFile(const String& pathName)
+	{
+		switch (getFormatOf(pathName))
+		{
+		case FileFormat::BINARY:
+			return BinaryGraphBuilder().buildFromFile(pathName);
+		case FileFormat::COMPRESSED:
+			return CompressedGraphBuilder().buildFromFile(pathName);
+		default:
+			return GraphBuilder().buildFromFile(pathName);
+		}
+	}
+
+	void save(const Graph& g, FileFormat format)
+	{
+		switch (format)
+		{
+		case FileFormat::BINARY:
+			BinaryGraphSaver().save(g);
+			break;
+		case FileFormat::COMPRESSED:
+			CompressedGraphSaver().save(g);
+			break;
+		default:
+			GraphSaver().save(g);
+			break;
+		}
+
+		for (auto otherFormat : FILE_FORMATS)
+		{
+			if (otherFormat != format)
+			{
+				removeFileFor(g.getID(), otherFormat);
+			}
+		}
+	}
 
-		forEach(iterator, [&builder, &graphs](const auto& pathName)
+	FileFormat getFormatOfFileFor(const String& graphID)
+	{
+		for (auto format : FILE_FORMATS)
 		{
-			auto graph = builder.buildFromFile(pathName);
+			if (fileExists(getFileNameFor(graphID, format)))
+			{
+				return format;
+			}
+		}
 
-			graphs.add(std::move(graph));
+		return FileFormat::TEXT;
+	}
+
+	bool hasFileFor(const String& graphID)
+	{
+		return std::any_of(std::begin(FILE_FORMATS), std::end(FILE_FORMATS),
+			               [&graphID](FileFormat format)
+		{
+			return fileExists(getFileNameFor(graphID, format));
 		});
+	}
 
-		return graphs;
+	void removeFileFor(const String& graphID)
+	{
+		for (auto format : FILE_FORMATS)
+		{
+			removeFileFor(graphID, format);
+		}
+
+		removeFileIfItExists(getPathIndexFileNameFor(graphID));
+	}
+
+	void removeFileFor(const String& graphID, FileFormat format)
+	{
+		removeFileIfItExists(getFileNameFor(graphID, format));
 	}
 
-	void removeFileFor(const Graph& g)
+	void removeFileIfItExists(const String& name)
 	{
 		try
 		{
 			auto fileName =
-				fs::path(getFileNameFor(g).cString());
+				fs::path(name.cString());
 
 			if (fs::exists(fileName))
 			{
@@ -50,9 +197,117 @@ namespace GraphIO
 		}
 	}
 
-	String getFileNameFor(const Graph& g)
+	bool fileExists(const String& name)
+	{
+		auto error = std::error_code{};
+
+		return fs::exists(fs::path(name.cString()), error);
+	}
+
+	String getTemporaryFileNameFor(const String& fileName)
+	{
+		return fileName + TEMPORARY_FILE_SUFFIX;
+	}
+
+	/*
+		Flushes the temporary file of fileName to the disk and renames it
+		onto fileName, so that the file is either left as it was or
+		entirely replaced, even if the program or the system stops
+		halfway through.
+	*/
+	void replaceWithTemporaryFile(const String& fileName)
+	{
+		auto temporaryFileName = getTemporaryFileNameFor(fileName);
+		synchroniseWithDisk(temporaryFileName);
+
+		try
+		{
+			fs::rename(fs::path(temporaryFileName.cString()),
+				       fs::path(fileName.cString()));
+		}
+		catch (fs::filesystem_error& e)
+		{
+			throw Exception(String(e.what()));
+		}
+	}
+
+	void removeTemporaryFileFor(const String& fileName) noexcept
+	{
+		auto error = std::error_code{};
+		fs::remove(fs::path(getTemporaryFileNameFor(fileName).cString()), error);
+	}
+
+	void synchroniseWithDisk(const String& fileName)
+	{
+		auto file = std::fopen(fileName.cString(), "ab");
+
+		if (file == nullptr)
+		{
+			throw Exception("Could not open \"" + fileName + "\"!");
+		}
+
+#ifdef _WIN32
+		auto result = _commit(_fileno(file));
+#else
+		auto result = fsync(fileno(file));
+#endif
+		std::fclose(file);
+
+		if (result != 0)
+		{
+			throw Exception("Could not synchronise \"" + fileName + "\"!");
+		}
+	}
+
+	String getFileNameFor(const String& graphID)
+	{
+		return graphID + FILE_EXTENSION;
+	}
+
+	String getBinaryFileNameFor(const String& graphID)
+	{
+		return graphID + BINARY_FILE_EXTENSION;
+	}
+
+	String getCompressedFileNameFor(const String& graphID)
+	{
+		return graphID + COMPRESSED_FILE_EXTENSION;
+	}
+
+	String getFileNameFor(const String& graphID, FileFormat format)
+	{
+		switch (format)
+		{
+		case FileFormat::BINARY:
+			return getBinaryFileNameFor(graphID);
+		case FileFormat::COMPRESSED:
+			return getCompressedFileNameFor(graphID);
+		default:
+			return getFileNameFor(graphID);
+		}
+	}
+
+	String getPathIndexFileNameFor(const String& graphID)
+	{
+		return graphID + PATH_INDEX_FILE_EXTENSION;
+	}
+
+	FileFormat getFormatOf(const String& pathName)
 	{
-		return g.getID() + FILE_EXTENSION;
+		auto extension = fs::path(pathName.cString()).extension();
+
+		if (extension == BINARY_FILE_EXTENSION)
+		{
+			return FileFormat::BINARY;
+		}
+		else if (extension == COMPRESSED_FILE_EXTENSION)
+		{
+			return FileFormat::COMPRESSED;
+		}
+		else
+		{
+			return FileFormat::TEXT;
+		}
 	}
 
 	void tryToRemoveExistingFile(const fs::path& name)
@@ -1,15 +1,40 @@
 #ifndef __GRAPH_FILES_FUNCTIONS_HEADER_INCLUDED__
 #define __GRAPH_FILES_FUNCTIONS_HEADER_INCLUDED__
 
+#include <memory>
+#include <vector>
+
 class String;
 class Graph;
 class GraphCollection;
 
 namespace GraphIO
 {
+	enum class FileFormat
+	{
+		TEXT,
+		BINARY,
+		COMPRESSED
+	};
+
 	GraphCollection loadDirectory(const String& path);
-	void removeFileFor(const Graph& g);
-	String getFileNameFor(const Graph& g);
+	std::vector<String> listGraphFilesIn(const String& path);
+	std::unique_ptr<Graph> buildFromFile(const String& pathName);
+	String readIDOfGraphIn(const String& pathName);
+	void save(const Graph& g, FileFormat format);
+	FileFormat getFormatOfFileFor(const String& graphID);
+	bool hasFileFor(const String& graphID);
+	void removeFileFor(const String& graphID);
+	void removeFileFor(const String& graphID, FileFormat format);
+	String getFileNameFor(const String& graphID);
+	String getBinaryFileNameFor(const String& graphID);
+	String getCompressedFileNameFor(const String& graphID);
+	String getFileNameFor(const String& graphID, FileFormat format);
+	String getPathIndexFileNameFor(const String& graphID);
+	bool fileExists(const String& name);
+	String getTemporaryFileNameFor(const String& fileName);
+	void replaceWithTemporaryFile(const String& fileName);
+	void removeTemporaryFileFor(const String& fileName) noexcept;
 }
 
 #endif //__GRAPH_FILES_FUNCTIONS_HEADER_INCLUDED__
\ No newline at end of file
@@ -4,6 +4,12 @@
 namespace GraphIO
 {
 	const char* const FILE_EXTENSION = ".txt";
+	const char* const BINARY_FILE_EXTENSION = ".gsb";
+	const char* const COMPRESSED_FILE_EXTENSION = ".gsc";
+	const char* const PATH_INDEX_FILE_EXTENSION = ".gsp";
+	const char* const JOURNAL_FILE_NAME = "journal.gsj";
+	const char* const CHECKPOINT_FILE_NAME = "checkpoint.gsi";
+	const char* const TEMPORARY_FILE_SUFFIX = ".tmp";
 
 	const char EDGE_START = '(';
 	const char EDGE_END = ')';
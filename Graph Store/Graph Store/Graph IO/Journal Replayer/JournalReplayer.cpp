@@ -0,0 +1,188 @@
+#include "JournalReplayer.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Graph Factory/GraphFactory.h"
+#include "Graph/Abstract class/Graph.h"
+#include <exception>
+#include <iostream>
+
+namespace GraphIO
+{
+	JournalReplayer::JournalReplayer(GraphCollection& graphs) noexcept :
+		graphs(graphs),
+		skippedRecordsCount(0)
+	{
+	}
+
+	std::size_t JournalReplayer::replay(const std::vector<Record>& records,
+		                                std::size_t firstRecord)
+	{
+		auto imports = findLastImports(records, firstRecord);
+		auto appliedRecordsCount = std::size_t{ 0 };
+
+		for (auto i = firstRecord; i < records.size(); ++i)
+		{
+			if (isChange(records[i])
+				&& !isSupersededByImport(records[i], i, imports)
+				&& tryToApply(records[i], i))
+			{
+				++appliedRecordsCount;
+			}
+		}
+
+		return appliedRecordsCount;
+	}
+
+	JournalReplayer::ImportPositions
+	JournalReplayer::findLastImports(const std::vector<Record>& records,
+		                             std::size_t firstRecord)
+	{
+		auto imports = ImportPositions{};
+
+		for (auto i = firstRecord; i < records.size(); ++i)
+		{
+			if (records[i].type == Journal::RecordType::IMPORT_GRAPH)
+			{
+				imports[records[i].graphID] = i;
+			}
+		}
+
+		return imports;
+	}
+
+	bool JournalReplayer::isChange(const Record& record) noexcept
+	{
+		return record.type != Journal::RecordType::CHECKPOINT;
+	}
+
+	bool JournalReplayer::isSupersededByImport(const Record& record,
+		                                       std::size_t position,
+		                                       const ImportPositions& imports)
+	{
+		auto iterator = imports.find(record.graphID);
+
+		return iterator != imports.cend() && position <= iterator->second;
+	}
+
+	std::size_t JournalReplayer::getSkippedRecordsCount() const noexcept
+	{
+		return skippedRecordsCount;
+	}
+
+	bool JournalReplayer::tryToApply(const Record& record, std::size_t position)
+	{
+		try
+		{
+			apply(record);
+
+			return true;
+		}
+		catch (std::exception& e)
+		{
+			reportSkipped(record, position, e);
+			++skippedRecordsCount;
+
+			return false;
+		}
+	}
+
+	void JournalReplayer::reportSkipped(const Record& record,
+		                                std::size_t position,
+		                                const std::exception& reason)
+	{
+		std::cerr << "Skipped journal record " << position + 1
+				  << " (" << getNameOf(record.type)
+				  << " on graph " << record.graphID << "): "
+				  << reason.what() << '\n';
+	}
+
+	const char* JournalReplayer::getNameOf(Journal::RecordType type) noexcept
+	{
+		switch (type)
+		{
+		case Journal::RecordType::ADD_GRAPH:
+			return "add-graph";
+		case Journal::RecordType::REMOVE_GRAPH:
+			return "remove-graph";
+		case Journal::RecordType::ADD_VERTEX:
+			return "add-vertex";
+		case Journal::RecordType::REMOVE_VERTEX:
+			return "remove-vertex";
+		case Journal::RecordType::ADD_EDGE:
+			return "add-edge";
+		case Journal::RecordType::REMOVE_EDGE:
+			return "remove-edge";
+		case Journal::RecordType::IMPORT_GRAPH:
+			return "import-graph";
+		default:
+			return "checkpoint";
+		}
+	}
+
+	void JournalReplayer::apply(const Record& record)
+	{
+		switch (record.type)
+		{
+		case Journal::RecordType::ADD_GRAPH:
+			addGraph(record);
+			break;
+		case Journal::RecordType::REMOVE_GRAPH:
+			removeGraph(record);
+			break;
+		case Journal::RecordType::ADD_VERTEX:
+			getGraph(record).addVertex(record.firstArgument);
+			break;
+		case Journal::RecordType::REMOVE_VERTEX:
+		{
+			Graph& g = getGraph(record);
+			g.removeVertex(g.getVertexWithID(record.firstArgument));
+			break;
+		}
+		case Journal::RecordType::ADD_EDGE:
+			addEdge(record);
+			break;
+		case Journal::RecordType::REMOVE_EDGE:
+			removeEdge(record);
+			break;
+		case Journal::RecordType::IMPORT_GRAPH:
+		case Journal::RecordType::CHECKPOINT:
+			break;
+		}
+	}
+
+	void JournalReplayer::addGraph(const Record& record)
+	{
+		graphs.add(GraphFactory::instance().createGraph(record.firstArgument,
+			                                            record.graphID));
+	}
+
+	void JournalReplayer::removeGraph(const Record& record)
+	{
+		if (graphs.contains(record.graphID))
+		{
+			graphs.remove(record.graphID);
+		}
+	}
+
+	void JournalReplayer::addEdge(const Record& record)
+	{
+		Graph& g = getGraph(record);
+		Graph::Vertex& start = g.getVertexWithID(record.firstArgument);
+		Graph::Vertex& end = g.getVertexWithID(record.secondArgument);
+
+		g.addEdge(start, end, record.weight);
+	}
+
+	void JournalReplayer::removeEdge(const Record& record)
+	{
+		Graph& g = getGraph(record);
+		Graph::Vertex& start = g.getVertexWithID(record.firstArgument);
+		Graph::Vertex& end = g.getVertexWithID(record.secondArgument);
+
+		g.removeEdge(start, end);
+	}
+
+	Graph& JournalReplayer::getGraph(const Record& record)
+	{
+		return graphs[record.graphID];
+	}
+}
\ No newline at end of file
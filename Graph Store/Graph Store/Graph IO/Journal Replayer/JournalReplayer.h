@@ -0,0 +1,58 @@
+#ifndef __JOURNAL_REPLAYER_HEADER_INCLUDED__
+#define __JOURNAL_REPLAYER_HEADER_INCLUDED__
+
+#include "Graph IO/Journal/Journal.h"
+#include <exception>
+#include <map>
+
+class Graph;
+class GraphCollection;
+
+namespace GraphIO
+{
+	/*
+		Applies journal records to the loaded graphs. An imported graph is
+		saved as soon as it is imported, so the records about its id that
+		precede the import are not replayed. A record that cannot be
+		applied is skipped and reported on the standard error stream.
+	*/
+	class JournalReplayer
+	{
+		using Record = Journal::Record;
+		using ImportPositions = std::map<String, std::size_t>;
+
+	public:
+		explicit JournalReplayer(GraphCollection& graphs) noexcept;
+
+		std::size_t replay(const std::vector<Record>& records,
+			               std::size_t firstRecord = 0);
+		std::size_t getSkippedRecordsCount() const noexcept;
+
+	private:
+		static ImportPositions findLastImports(const std::vector<Record>& records,
+			                                   std::size_t firstRecord);
+		static bool isChange(const Record& record) noexcept;
+		static bool isSupersededByImport(const Record& record,
+			                             std::size_t position,
+			                             const ImportPositions& imports);
+		static const char* getNameOf(Journal::RecordType type) noexcept;
+		static void reportSkipped(const Record& record,
+			                      std::size_t position,
+			                      const std::exception& reason);
+
+	private:
+		bool tryToApply(const Record& record, std::size_t position);
+		void apply(const Record& record);
+		void addGraph(const Record& record);
+		void removeGraph(const Record& record);
+		void addEdge(const Record& record);
+		void removeEdge(const Record& record);
+		Graph& getGraph(const Record& record);
+
+	private:
+		GraphCollection& graphs;
+		std::size_t skippedRecordsCount;
+	};
+}
+
+#endif //__JOURNAL_REPLAYER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,413 @@
+#include "Journal.h"
+#include "Graph IO/Exception.h"
+#include "Graph IO/GraphIOConstants.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include "Graph IO/Little Endian/LittleEndian.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <assert.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace GraphIO
+{
+	namespace
+	{
+		const std::size_t TYPE_SIZE = 1;
+		const std::size_t PAYLOAD_SIZE_SIZE = 4;
+		const std::size_t CHECKSUM_SIZE = 8;
+	}
+
+	Journal::Journal() noexcept :
+		file(nullptr),
+		size(0)
+	{
+	}
+
+	Journal::~Journal()
+	{
+		close();
+	}
+
+	std::vector<Journal::Record> Journal::open(const String& fileName)
+	{
+		close();
+		this->fileName = fileName;
+
+		auto contents = readContents();
+		auto validPrefixSize = std::size_t{ 0 };
+		auto records = parseRecordsFrom(contents, validPrefixSize);
+
+		if (validPrefixSize != contents.size())
+		{
+			truncateTo(validPrefixSize);
+		}
+
+		size = validPrefixSize;
+		openForAppending();
+
+		return records;
+	}
+
+	std::string Journal::readContents() const
+	{
+		auto input = std::ifstream(fileName.cString(), std::ios::in | std::ios::binary);
+
+		return std::string(std::istreambuf_iterator<char>(input),
+			               std::istreambuf_iterator<char>());
+	}
+
+	void Journal::truncateTo(std::size_t size)
+	{
+		try
+		{
+			fs::resize_file(fs::path(fileName.cString()), size);
+		}
+		catch (fs::filesystem_error& e)
+		{
+			throw Exception(String(e.what()));
+		}
+	}
+
+	void Journal::openForAppending()
+	{
+		assert(file == nullptr);
+
+		file = std::fopen(fileName.cString(), "ab");
+
+		if (file == nullptr)
+		{
+			throw Exception("Could not open the journal \"" + fileName + "\"!");
+		}
+	}
+
+	void Journal::close() noexcept
+	{
+		if (isOpen())
+		{
+			std::fclose(file);
+			file = nullptr;
+			pendingRecords.clear();
+			size = 0;
+		}
+	}
+
+	bool Journal::isOpen() const noexcept
+	{
+		return file != nullptr;
+	}
+
+	std::vector<Journal::Record>
+	Journal::parseRecordsFrom(const std::string& contents,
+		                      std::size_t& validPrefixSize)
+	{
+		auto records = std::vector<Record>{};
+		auto position = std::size_t{ 0 };
+		auto record = Record{};
+
+		while (tryToParseRecord(contents, position, record))
+		{
+			records.push_back(std::move(record));
+		}
+
+		validPrefixSize = position;
+
+		return records;
+	}
+
+	bool Journal::tryToParseRecord(const std::string& contents,
+		                           std::size_t& position,
+		                           Record& record)
+	{
+		auto header = LittleEndian::Reader(contents.data() + position,
+			                        contents.data() + contents.size());
+		auto type = std::uint64_t{};
+		auto payloadSize = std::uint64_t{};
+
+		if (!header.readNumber(type, TYPE_SIZE)
+			|| !header.readNumber(payloadSize, PAYLOAD_SIZE_SIZE)
+			|| type < static_cast<std::uint64_t>(RecordType::ADD_GRAPH)
+			|| type > static_cast<std::uint64_t>(RecordType::CHECKPOINT)
+			|| contents.size() - position < TYPE_SIZE + PAYLOAD_SIZE_SIZE + payloadSize + CHECKSUM_SIZE)
+		{
+			return false;
+		}
+
+		auto recordStart = contents.data() + position;
+		auto payload = recordStart + TYPE_SIZE + PAYLOAD_SIZE_SIZE;
+		auto payloadEnd = payload + payloadSize;
+		auto checksum = std::uint64_t{};
+		LittleEndian::Reader(payloadEnd, payloadEnd + CHECKSUM_SIZE).readNumber(checksum, CHECKSUM_SIZE);
+
+		if (checksum != computeChecksumOf(recordStart, payloadEnd - recordStart))
+		{
+			return false;
+		}
+
+		auto reader = LittleEndian::Reader(payload, payloadEnd);
+		auto weight = std::uint64_t{};
+		record.type = static_cast<RecordType>(type);
+
+		if (!reader.readString(record.graphID)
+			|| !reader.readString(record.firstArgument)
+			|| !reader.readString(record.secondArgument)
+			|| !reader.readNumber(weight, 4)
+			|| !reader.hasReachedEnd())
+		{
+			return false;
+		}
+
+		record.weight = static_cast<std::uint32_t>(weight);
+		position = payloadEnd + CHECKSUM_SIZE - contents.data();
+
+		return true;
+	}
+
+	void Journal::logAddGraph(const String& graphID, const String& type)
+	{
+		append({ RecordType::ADD_GRAPH, graphID, type, ""_s, 0 });
+	}
+
+	void Journal::logRemoveGraph(const String& graphID)
+	{
+		append({ RecordType::REMOVE_GRAPH, graphID, ""_s, ""_s, 0 });
+	}
+
+	void Journal::logAddVertex(const String& graphID, const String& vertexID)
+	{
+		append({ RecordType::ADD_VERTEX, graphID, vertexID, ""_s, 0 });
+	}
+
+	void Journal::logRemoveVertex(const String& graphID, const String& vertexID)
+	{
+		append({ RecordType::REMOVE_VERTEX, graphID, vertexID, ""_s, 0 });
+	}
+
+	void Journal::logAddEdge(const String& graphID,
+		                     const String& startID,
+		                     const String& endID,
+		                     std::uint32_t weight)
+	{
+		append({ RecordType::ADD_EDGE, graphID, startID, endID, weight });
+	}
+
+	void Journal::logRemoveEdge(const String& graphID,
+		                        const String& startID,
+		                        const String& endID)
+	{
+		append({ RecordType::REMOVE_EDGE, graphID, startID, endID, 0 });
+	}
+
+	void Journal::logImportGraph(const String& graphID)
+	{
+		append({ RecordType::IMPORT_GRAPH, graphID, ""_s, ""_s, 0 });
+	}
+
+	void Journal::logCheckpoint(std::uint64_t checkpointID)
+	{
+		append({ RecordType::CHECKPOINT, ""_s, String(std::to_string(checkpointID).c_str()), ""_s, 0 });
+	}
+
+	void Journal::append(const Record& record)
+	{
+		verifyIsOpen();
+
+		auto bytes = encode(record);
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		pendingRecords += bytes;
+	}
+
+	std::string Journal::encode(const Record& record)
+	{
+		auto payload = std::string{};
+		LittleEndian::appendString(payload, record.graphID);
+		LittleEndian::appendString(payload, record.firstArgument);
+		LittleEndian::appendString(payload, record.secondArgument);
+		LittleEndian::appendNumber(payload, record.weight, 4);
+
+		auto bytes = std::string{};
+		LittleEndian::appendNumber(bytes, static_cast<std::uint64_t>(record.type), TYPE_SIZE);
+		LittleEndian::appendNumber(bytes, payload.size(), PAYLOAD_SIZE_SIZE);
+		bytes += payload;
+		LittleEndian::appendNumber(bytes, computeChecksumOf(bytes.data(), bytes.size()), CHECKSUM_SIZE);
+
+		return bytes;
+	}
+
+	std::uint64_t Journal::computeChecksumOf(const char* bytes, std::size_t count)
+	{
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(bytes, count);
+
+		return checksum.getValue();
+	}
+
+	void Journal::commit()
+	{
+		verifyIsOpen();
+
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		if (hasPendingRecords())
+		{
+			writePendingRecords();
+			synchroniseWithDisk(file, fileName);
+		}
+	}
+
+	void Journal::writePendingRecords()
+	{
+		auto written =
+			std::fwrite(pendingRecords.data(), 1, pendingRecords.size(), file);
+
+		if (written != pendingRecords.size() || std::fflush(file) != 0)
+		{
+			discardPartialRecords();
+
+			throw Exception("Could not write to the journal \"" + fileName + "\"!");
+		}
+
+		size += pendingRecords.size();
+		pendingRecords.clear();
+	}
+
+	/*
+		Truncates the file back to its last whole record so that the pending
+		records can be written again. If that fails, the journal is left
+		closed rather than with a torn record in the middle.
+	*/
+	void Journal::discardPartialRecords() noexcept
+	{
+		std::fclose(file);
+		file = nullptr;
+
+		try
+		{
+			truncateTo(size);
+			openForAppending();
+		}
+		catch (std::exception&)
+		{
+			pendingRecords.clear();
+			size = 0;
+		}
+	}
+
+	void Journal::synchroniseWithDisk(std::FILE* file, const String& fileName)
+	{
+#ifdef _WIN32
+		auto result = _commit(_fileno(file));
+#else
+		auto result = fsync(fileno(file));
+#endif
+
+		if (result != 0)
+		{
+			throw Exception("Could not synchronise the journal \"" + fileName + "\"!");
+		}
+	}
+
+	void Journal::clear()
+	{
+		verifyIsOpen();
+
+		std::fclose(file);
+		file = nullptr;
+		pendingRecords.clear();
+		truncateTo(0);
+		size = 0;
+		openForAppending();
+	}
+
+	void Journal::discardRecordsBefore(std::size_t position)
+	{
+		verifyIsOpen();
+		commit();
+		assert(position <= size);
+
+		auto remainingRecords = readContents().substr(position);
+		auto temporaryFileName = fileName + TEMPORARY_FILE_SUFFIX;
+		writeToTemporaryFile(temporaryFileName, remainingRecords);
+
+		std::fclose(file);
+		file = nullptr;
+		replaceWith(temporaryFileName);
+		size = remainingRecords.size();
+		openForAppending();
+	}
+
+	void Journal::writeToTemporaryFile(const String& name,
+		                               const std::string& contents) const
+	{
+		auto temporaryFile = std::fopen(name.cString(), "wb");
+
+		if (temporaryFile == nullptr)
+		{
+			throw Exception("Could not open \"" + name + "\"!");
+		}
+
+		auto written =
+			std::fwrite(contents.data(), 1, contents.size(), temporaryFile);
+		auto isWritten =
+			written == contents.size() && std::fflush(temporaryFile) == 0;
+
+		try
+		{
+			if (!isWritten)
+			{
+				throw Exception("Could not write to \"" + name + "\"!");
+			}
+
+			synchroniseWithDisk(temporaryFile, name);
+		}
+		catch (...)
+		{
+			std::fclose(temporaryFile);
+			throw;
+		}
+
+		std::fclose(temporaryFile);
+	}
+
+	void Journal::replaceWith(const String& temporaryFileName)
+	{
+		try
+		{
+			fs::rename(fs::path(temporaryFileName.cString()),
+				       fs::path(fileName.cString()));
+		}
+		catch (fs::filesystem_error& e)
+		{
+			openForAppending();
+			throw Exception(String(e.what()));
+		}
+	}
+
+	std::size_t Journal::getSize() const noexcept
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		return size + pendingRecords.size();
+	}
+
+	bool Journal::hasPendingRecords() const noexcept
+	{
+		return !pendingRecords.empty();
+	}
+
+	void Journal::verifyIsOpen() const
+	{
+		if (!isOpen())
+		{
+			throw Exception("The journal is not open!"_s);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef __JOURNAL_HEADER_INCLUDED__
+#define __JOURNAL_HEADER_INCLUDED__
+
+#include "String/String.h"
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+	An append-only log of the mutations done since the graph files were
+	last saved. Each record is stored as:
+		std::uint8_t type
+		std::uint32_t payloadSize
+		char payload[payloadSize]
+		std::uint64_t checksum (FNV-1a of the type, the size and the payload)
+	A record that is cut off or does not match its checksum ends the log.
+	Records may be logged and committed by several threads at a time;
+	the rest of the operations expect that no records are being logged.
+*/
+namespace GraphIO
+{
+	class Journal
+	{
+	public:
+		enum class RecordType : std::uint8_t
+		{
+			ADD_GRAPH = 1,
+			REMOVE_GRAPH,
+			ADD_VERTEX,
+			REMOVE_VERTEX,
+			ADD_EDGE,
+			REMOVE_EDGE,
+			IMPORT_GRAPH,
+			CHECKPOINT
+		};
+
+		struct Record
+		{
+			RecordType type;
+			String graphID;
+			String firstArgument;
+			String secondArgument;
+			std::uint32_t weight;
+		};
+
+	public:
+		Journal() noexcept;
+		Journal(const Journal&) = delete;
+		Journal& operator=(const Journal&) = delete;
+		~Journal();
+
+		std::vector<Record> open(const String& fileName);
+		void close() noexcept;
+		bool isOpen() const noexcept;
+
+		void logAddGraph(const String& graphID, const String& type);
+		void logRemoveGraph(const String& graphID);
+		void logAddVertex(const String& graphID, const String& vertexID);
+		void logRemoveVertex(const String& graphID, const String& vertexID);
+		void logAddEdge(const String& graphID,
+			            const String& startID,
+			            const String& endID,
+			            std::uint32_t weight);
+		void logRemoveEdge(const String& graphID,
+			               const String& startID,
+			               const String& endID);
+		void logImportGraph(const String& graphID);
+		void logCheckpoint(std::uint64_t checkpointID);
+		void commit();
+		void clear();
+		void discardRecordsBefore(std::size_t position);
+
+		std::size_t getSize() const noexcept;
+		bool hasPendingRecords() const noexcept;
+
+	private:
+		static std::vector<Record> parseRecordsFrom(const std::string& contents,
+			                                        std::size_t& validPrefixSize);
+		static bool tryToParseRecord(const std::string& contents,
+			                         std::size_t& position,
+			                         Record& record);
+		static std::string encode(const Record& record);
+		static std::uint64_t computeChecksumOf(const char* bytes, std::size_t count);
+		static void synchroniseWithDisk(std::FILE* file, const String& fileName);
+
+	private:
+		void append(const Record& record);
+		std::string readContents() const;
+		void truncateTo(std::size_t size);
+		void openForAppending();
+		void verifyIsOpen() const;
+		void writePendingRecords();
+		void discardPartialRecords() noexcept;
+		void writeToTemporaryFile(const String& name, const std::string& contents) const;
+		void replaceWith(const String& temporaryFileName);
+
+	private:
+		String fileName;
+		std::FILE* file;
+		std::string pendingRecords;
+		std::size_t size;
+		mutable std::mutex mutex;
+	};
+}
+
+#endif //__JOURNAL_HEADER_INCLUDED__
\ No newline at end of file
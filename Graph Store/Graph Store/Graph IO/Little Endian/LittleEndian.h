@@ -0,0 +1,102 @@
+#ifndef __LITTLE_ENDIAN_HEADER_INCLUDED__
+#define __LITTLE_ENDIAN_HEADER_INCLUDED__
+
+#include "String/String.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+/*
+	Reading and writing of the numbers and strings in the journal and in
+	the path index files. Numbers are little-endian and strings are stored
+	as their length (std::uint32_t) followed by their characters.
+*/
+
+namespace GraphIO
+{
+	namespace LittleEndian
+	{
+		const std::size_t STRING_LENGTH_SIZE = 4;
+
+		inline void appendNumber(std::string& bytes,
+			                     std::uint64_t number,
+			                     std::size_t bytesCount)
+		{
+			for (auto i = std::size_t{ 0 }; i < bytesCount; ++i)
+			{
+				bytes.push_back(static_cast<char>((number >> (8 * i)) & 0xFF));
+			}
+		}
+
+		inline void appendString(std::string& bytes, const String& s)
+		{
+			auto length = std::strlen(s.cString());
+
+			appendNumber(bytes, length, STRING_LENGTH_SIZE);
+			bytes.append(s.cString(), length);
+		}
+
+		/*
+			Reads from a range of bytes. A read that would go past the end
+			of the range fails and leaves the position unchanged.
+		*/
+		class Reader
+		{
+		public:
+			Reader(const char* begin, const char* end) noexcept :
+				position(begin),
+				end(end)
+			{
+			}
+
+			bool readNumber(std::uint64_t& number, std::size_t bytesCount) noexcept
+			{
+				if (static_cast<std::size_t>(end - position) < bytesCount)
+				{
+					return false;
+				}
+
+				number = 0;
+
+				for (auto i = std::size_t{ 0 }; i < bytesCount; ++i)
+				{
+					number |= std::uint64_t{ static_cast<unsigned char>(position[i]) } << (8 * i);
+				}
+
+				position += bytesCount;
+
+				return true;
+			}
+
+			bool readString(String& s)
+			{
+				auto start = position;
+				auto length = std::uint64_t{};
+
+				if (!readNumber(length, STRING_LENGTH_SIZE)
+					|| static_cast<std::uint64_t>(end - position) < length)
+				{
+					position = start;
+					return false;
+				}
+
+				s = String(std::string(position, static_cast<std::size_t>(length)).c_str());
+				position += length;
+
+				return true;
+			}
+
+			bool hasReachedEnd() const noexcept
+			{
+				return position == end;
+			}
+
+		private:
+			const char* position;
+			const char* end;
+		};
+	}
+}
+
+#endif //__LITTLE_ENDIAN_HEADER_INCLUDED__
\ No newline at end of file
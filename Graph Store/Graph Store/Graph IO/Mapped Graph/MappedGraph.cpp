@@ -0,0 +1,197 @@
+#include "MappedGraph.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include "Graph IO/Exception.h"
+#include "String/String.h"
+#include <cstring>
+
+namespace GraphIO
+{
+	namespace
+	{
+		const char* const UNDIRECTED_GRAPH_TYPE = "undirected";
+	}
+
+	void MappedGraph::open(const String& fileName)
+	{
+		close();
+
+		try
+		{
+			file.open(fileName);
+			verifyFileSize();
+			readHeader();
+			locateSections();
+		}
+		catch (OpenFileFailException& e)
+		{
+			close();
+			throw Exception(String(e.what()));
+		}
+		catch (std::exception& e)
+		{
+			close();
+			throw Exception(e.what() + "\nError in: "_s + fileName);
+		}
+	}
+
+	void MappedGraph::verifyFileSize() const
+	{
+		verify(file.getSize() >= sizeof(BinaryFormat::Header) + sizeof(std::uint64_t),
+			   "The file is too small to be a binary graph file!");
+	}
+
+	void MappedGraph::readHeader()
+	{
+		position = file.getData();
+		header = *take<BinaryFormat::Header>(1);
+
+		verify(std::memcmp(header.magic, BinaryFormat::MAGIC, sizeof(header.magic)) == 0,
+			   "This is not a binary graph file!");
+		verify(header.version == BinaryFormat::VERSION,
+			   "Unsupported binary graph file version!");
+		verify(header.verticesCount <= UINT32_MAX,
+			   "Too many vertices!");
+	}
+
+	void MappedGraph::locateSections()
+	{
+		stringOffsets = take<BinaryFormat::Offset>(header.verticesCount + 3);
+		verify(header.stringPoolSize <= file.getSize(), "Unexpected end of file!");
+		stringPool = take<char>(BinaryFormat::padToAlignment(header.stringPoolSize));
+		edgeOffsets = take<BinaryFormat::Offset>(header.verticesCount + 1);
+		edgeEnds = take<BinaryFormat::VertexIndex>(header.edgesCount);
+		edgeWeights = take<BinaryFormat::Weight>(header.edgesCount);
+		take<char>(BinaryFormat::padToAlignment(2 * sizeof(std::uint32_t) * header.edgesCount)
+			       - 2 * sizeof(std::uint32_t) * header.edgesCount);
+
+		verify(position + sizeof(std::uint64_t) == file.getData() + file.getSize(),
+			   "Unexpected data after the edges!");
+	}
+
+	template <class T>
+	const T* MappedGraph::take(std::uint64_t count)
+	{
+		auto end = file.getData() + file.getSize() - sizeof(std::uint64_t);
+		auto available = static_cast<std::uint64_t>(end - position) / sizeof(T);
+
+		verify(count <= available, "Unexpected end of file!");
+
+		auto result = reinterpret_cast<const T*>(position);
+		position += count * sizeof(T);
+
+		return result;
+	}
+
+	void MappedGraph::close() noexcept
+	{
+		file.close();
+		position = nullptr;
+		header = {};
+		incomingEdgeOffsets.clear();
+		incomingEdges.clear();
+	}
+
+	const char* MappedGraph::getID() const
+	{
+		return getString(0);
+	}
+
+	const char* MappedGraph::getType() const
+	{
+		return getString(1);
+	}
+
+	const char* MappedGraph::getVertexID(std::size_t index) const
+	{
+		verifyVertexIndex(index);
+
+		return getString(index + 2);
+	}
+
+	const char* MappedGraph::getString(std::size_t index) const
+	{
+		auto begin = stringOffsets[index];
+		auto end = stringOffsets[index + 1];
+
+		verify(begin < end && end <= header.stringPoolSize && stringPool[end - 1] == '\0',
+			   "Invalid string offsets!");
+
+		return stringPool + begin;
+	}
+
+	std::size_t MappedGraph::getVerticesCount() const noexcept
+	{
+		return static_cast<std::size_t>(header.verticesCount);
+	}
+
+	std::size_t MappedGraph::getEdgesCount() const noexcept
+	{
+		return static_cast<std::size_t>(header.edgesCount);
+	}
+
+	bool MappedGraph::isUndirected() const
+	{
+		return std::strcmp(getType(), UNDIRECTED_GRAPH_TYPE) == 0;
+	}
+
+	void MappedGraph::collectIncomingEdgesIfNeeded() const
+	{
+		if (!incomingEdgeOffsets.empty())
+		{
+			return;
+		}
+
+		auto offsets = std::vector<BinaryFormat::Offset>(header.verticesCount + 1, 0);
+
+		for (auto v = std::size_t{ 0 }; v < header.verticesCount; ++v)
+		{
+			verifyEdgeOffsetsOf(v);
+
+			for (auto e = edgeOffsets[v]; e < edgeOffsets[v + 1]; ++e)
+			{
+				verifyVertexIndex(edgeEnds[e]);
+				++offsets[edgeEnds[e] + 1];
+			}
+		}
+
+		for (auto i = std::size_t{ 1 }; i < offsets.size(); ++i)
+		{
+			offsets[i] += offsets[i - 1];
+		}
+
+		auto edges = std::vector<IncomingEdge>(static_cast<std::size_t>(header.edgesCount));
+		auto nextPositions = std::vector<BinaryFormat::Offset>(offsets.cbegin(), offsets.cend() - 1);
+
+		for (auto v = std::size_t{ 0 }; v < header.verticesCount; ++v)
+		{
+			for (auto e = edgeOffsets[v]; e < edgeOffsets[v + 1]; ++e)
+			{
+				edges[nextPositions[edgeEnds[e]]++] =
+					{ e, static_cast<BinaryFormat::VertexIndex>(v) };
+			}
+		}
+
+		incomingEdgeOffsets = std::move(offsets);
+		incomingEdges = std::move(edges);
+	}
+
+	void MappedGraph::verifyEdgeOffsetsOf(std::size_t index) const
+	{
+		verify(edgeOffsets[index] <= edgeOffsets[index + 1]
+			   && edgeOffsets[index + 1] <= header.edgesCount,
+			   "Invalid edge offsets!");
+	}
+
+	void MappedGraph::verifyVertexIndex(std::size_t index) const
+	{
+		verify(index < header.verticesCount, "Invalid vertex index!");
+	}
+
+	void MappedGraph::verify(bool condition, const char* message)
+	{
+		if (!condition)
+		{
+			throw Exception(String(message));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#ifndef __MAPPED_GRAPH_HEADER_INCLUDED__
+#define __MAPPED_GRAPH_HEADER_INCLUDED__
+
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include <vector>
+
+class String;
+
+namespace GraphIO
+{
+	/*
+		A read-only view of a graph stored in a binary file. The file is
+		mapped and used in place, so opening it takes constant time and
+		only the pages that are read are brought into memory. Offsets and
+		indices are verified when they are used and the checksum is not
+		verified at all.
+	*/
+	class MappedGraph
+	{
+		struct IncomingEdge
+		{
+			BinaryFormat::Offset position;
+			BinaryFormat::VertexIndex start;
+		};
+
+	public:
+		MappedGraph() = default;
+		MappedGraph(const MappedGraph&) = delete;
+		MappedGraph& operator=(const MappedGraph&) = delete;
+
+		void open(const String& fileName);
+		void close() noexcept;
+
+		const char* getID() const;
+		const char* getType() const;
+		const char* getVertexID(std::size_t index) const;
+		std::size_t getVerticesCount() const noexcept;
+		std::size_t getEdgesCount() const noexcept;
+
+		template <class Function>
+		void forEachEdgeLeaving(std::size_t index, Function f) const;
+
+	private:
+		static void verify(bool condition, const char* message);
+
+	private:
+		void verifyFileSize() const;
+		void readHeader();
+		void locateSections();
+		const char* getString(std::size_t index) const;
+		bool isUndirected() const;
+		void collectIncomingEdgesIfNeeded() const;
+		void verifyEdgeOffsetsOf(std::size_t index) const;
+		void verifyVertexIndex(std::size_t index) const;
+		template <class T>
+		const T* take(std::uint64_t count);
+
+	private:
+		MemoryMappedFile file;
+		const char* position = nullptr;
+		BinaryFormat::Header header = {};
+		const BinaryFormat::Offset* stringOffsets = nullptr;
+		const char* stringPool = nullptr;
+		const BinaryFormat::Offset* edgeOffsets = nullptr;
+		const BinaryFormat::VertexIndex* edgeEnds = nullptr;
+		const BinaryFormat::Weight* edgeWeights = nullptr;
+		mutable std::vector<BinaryFormat::Offset> incomingEdgeOffsets;
+		mutable std::vector<IncomingEdge> incomingEdges;
+	};
+
+	/*
+		The edges are visited in the order in which they are listed by a
+		graph built from the same file. Undirected graphs store each edge
+		once, so the edges stored with other vertices are indexed on first
+		use.
+	*/
+	template <class Function>
+	void MappedGraph::forEachEdgeLeaving(std::size_t index, Function f) const
+	{
+		verifyVertexIndex(index);
+		verifyEdgeOffsetsOf(index);
+
+		auto outgoing = edgeOffsets[index + 1];
+		auto outgoingEnd = edgeOffsets[index];
+		auto incoming = std::uint64_t{ 0 };
+		auto incomingEnd = std::uint64_t{ 0 };
+
+		if (isUndirected())
+		{
+			collectIncomingEdgesIfNeeded();
+			incoming = incomingEdgeOffsets[index + 1];
+			incomingEnd = incomingEdgeOffsets[index];
+		}
+
+		while (outgoing != outgoingEnd || incoming != incomingEnd)
+		{
+			if (incoming == incomingEnd
+				|| (outgoing != outgoingEnd
+					&& outgoing - 1 > incomingEdges[incoming - 1].position))
+			{
+				--outgoing;
+				verifyVertexIndex(edgeEnds[outgoing]);
+				f(std::size_t{ edgeEnds[outgoing] }, edgeWeights[outgoing]);
+			}
+			else
+			{
+				--incoming;
+				const IncomingEdge& e = incomingEdges[incoming];
+				f(std::size_t{ e.start }, edgeWeights[e.position]);
+			}
+		}
+	}
+}
+
+#endif //__MAPPED_GRAPH_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,280 @@
+#include "PathIndex.h"
+#include "Graph IO/GraphFilesFunctions.h"
+#include "Graph IO/Binary Format/BinaryFormat.h"
+#include "Graph IO/Exception.h"
+#include "Graph IO/Content Hash/ContentHash.h"
+#include "Graph IO/Little Endian/LittleEndian.h"
+#include "Graph Collection/GraphCollection.h"
+#include "Memory Mapped File/MemoryMappedFile.h"
+#include "Logger/Logger.h"
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <shared_mutex>
+#include <vector>
+
+namespace GraphIO
+{
+	namespace
+	{
+		const std::uint64_t NO_PATH_LENGTH = std::numeric_limits<std::uint64_t>::max();
+		const std::size_t CHECKSUM_SIZE = sizeof(std::uint64_t);
+	}
+
+	const char PathIndex::MAGIC[4] = { 'G', 'S', 'P', 'I' };
+
+	PathIndex::PathIndex() noexcept :
+		changesCount(0)
+	{
+	}
+
+	/*
+		Returns the indexed paths of the graph the first time it is asked
+		for them and nothing after that. The file is checked against the
+		contents of the graph, which the caller must not let change.
+	*/
+	PathIndex::Entries PathIndex::load(const Graph& g)
+	{
+		auto entries = Entries{};
+		auto fileName = getPathIndexFileNameFor(g.getID());
+
+		if (!markAsLoaded(g) || !fileExists(fileName))
+		{
+			return entries;
+		}
+
+		try
+		{
+			auto lock = std::lock_guard<std::mutex>(filesMutex);
+
+			auto file = MemoryMappedFile(fileName);
+
+			if (!tryToLoad(file.getData(), file.getSize(), g, entries))
+			{
+				entries.clear();
+			}
+		}
+		catch (std::exception&)
+		{
+			// A damaged index only means that the searches are run again.
+			entries.clear();
+		}
+
+		return entries;
+	}
+
+	bool PathIndex::markAsLoaded(const Graph& g)
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		return loadedGraphs.insert(g.getID()).second;
+	}
+
+	bool PathIndex::tryToLoad(const char* data,
+		                      std::size_t size,
+		                      const Graph& g,
+		                      Entries& entries)
+	{
+		if (size < sizeof(MAGIC) + CHECKSUM_SIZE
+			|| std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+		{
+			return false;
+		}
+
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(data, size - CHECKSUM_SIZE);
+		auto reader = LittleEndian::Reader(data + sizeof(MAGIC), data + size - CHECKSUM_SIZE);
+		auto storedChecksum = std::uint64_t{};
+		auto version = std::uint64_t{};
+		auto contentHash = std::uint64_t{};
+		auto entriesCount = std::uint64_t{};
+		LittleEndian::Reader(data + size - CHECKSUM_SIZE, data + size).readNumber(storedChecksum, CHECKSUM_SIZE);
+
+		if (storedChecksum != checksum.getValue()
+			|| !reader.readNumber(version, 4)
+			|| version != VERSION
+			|| !reader.readNumber(contentHash, 8)
+			|| contentHash != computeContentHashOf(g)
+			|| !reader.readNumber(entriesCount, 8))
+		{
+			return false;
+		}
+
+		for (auto i = std::uint64_t{ 0 }; i < entriesCount; ++i)
+		{
+			auto query = PathCache::Query{ g.getID(), g.getVersion() };
+			auto length = std::uint64_t{};
+			auto idsCount = std::uint64_t{};
+
+			if (!reader.readString(query.sourceID)
+				|| !reader.readString(query.targetID)
+				|| !reader.readString(query.algorithmID)
+				|| !reader.readNumber(length, 8)
+				|| !reader.readNumber(idsCount, 4))
+			{
+				return false;
+			}
+
+			auto ids = std::forward_list<String>{};
+			auto last = ids.before_begin();
+
+			for (auto j = std::uint64_t{ 0 }; j < idsCount; ++j)
+			{
+				auto id = String{};
+
+				if (!reader.readString(id))
+				{
+					return false;
+				}
+
+				last = ids.insert_after(last, std::move(id));
+			}
+
+			auto distance = (length == NO_PATH_LENGTH) ?
+				            Distance::getInfinity() :
+				            Distance(static_cast<unsigned>(length));
+			entries.emplace_back(std::move(query), PathCache::Path(std::move(ids), distance));
+		}
+
+		return reader.hasReachedEnd();
+	}
+
+	void PathIndex::update(const Graph& g, Entries entries)
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		changes[g.getID()] = Change{ g.getVersion(), std::move(entries) };
+		++changesCount;
+	}
+
+	/*
+		The paths of graphs that no longer have a file are not saved, as
+		the file of a removed graph would otherwise be written again.
+		Neither are the paths of graphs that have changed since they were
+		found, as a later search records them again.
+	*/
+	void PathIndex::saveChanges(const GraphCollection& graphs) noexcept
+	{
+		auto changesToSave = std::map<String, Change>{};
+
+		{
+			auto lock = std::lock_guard<std::mutex>(mutex);
+
+			std::swap(changesToSave, changes);
+			changesCount = 0;
+		}
+
+		for (const auto& pair : changesToSave)
+		{
+			try
+			{
+				if (!hasFileFor(pair.first))
+				{
+					continue;
+				}
+
+				auto contentHash =
+					getContentHashIfUnchanged(graphs, pair.first, pair.second.version);
+
+				if (contentHash)
+				{
+					auto bytes = encode(pair.second.entries, *contentHash);
+					auto lock = std::lock_guard<std::mutex>(filesMutex);
+
+					write(getPathIndexFileNameFor(pair.first), bytes);
+				}
+			}
+			catch (std::exception& e)
+			{
+				Logger::logError(e);
+			}
+		}
+	}
+
+	void PathIndex::write(const String& fileName, const std::string& bytes)
+	{
+		try
+		{
+			auto file = std::ofstream(getTemporaryFileNameFor(fileName).cString(),
+				                      std::ios::out | std::ios::trunc | std::ios::binary);
+			file.write(bytes.data(), bytes.size());
+			file.close();
+
+			if (!file)
+			{
+				throw Exception("Could not write \"" + fileName + "\"!");
+			}
+
+			replaceWithTemporaryFile(fileName);
+		}
+		catch (...)
+		{
+			removeTemporaryFileFor(fileName);
+			throw;
+		}
+	}
+
+	std::size_t PathIndex::getChangesCount() const noexcept
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		return changesCount;
+	}
+
+	std::string PathIndex::encode(const Entries& entries,
+		                          std::uint64_t contentHash)
+	{
+		auto bytes = std::string(MAGIC, sizeof(MAGIC));
+		LittleEndian::appendNumber(bytes, VERSION, 4);
+		LittleEndian::appendNumber(bytes, contentHash, 8);
+		LittleEndian::appendNumber(bytes, entries.size(), 8);
+
+		for (const auto& entry : entries)
+		{
+			const PathCache::Query& query = entry.first;
+			const PathCache::Path& path = entry.second;
+			const Distance& length = path.getLength();
+			const std::forward_list<String>& ids = path.getIDs();
+
+			LittleEndian::appendString(bytes, query.sourceID);
+			LittleEndian::appendString(bytes, query.targetID);
+			LittleEndian::appendString(bytes, query.algorithmID);
+			LittleEndian::appendNumber(bytes, length.isInfinite() ? NO_PATH_LENGTH : length.getValue(), 8);
+			LittleEndian::appendNumber(bytes, std::distance(ids.cbegin(), ids.cend()), 4);
+
+			for (const String& id : ids)
+			{
+				LittleEndian::appendString(bytes, id);
+			}
+		}
+
+		auto checksum = BinaryFormat::Checksum{};
+		checksum.update(bytes.data(), bytes.size());
+		LittleEndian::appendNumber(bytes, checksum.getValue(), CHECKSUM_SIZE);
+
+		return bytes;
+	}
+
+	/*
+		Other commands may change the graph while the index is saved, so it
+		is read under its lock.
+	*/
+	std::optional<std::uint64_t>
+	PathIndex::getContentHashIfUnchanged(const GraphCollection& graphs,
+		                                 const String& id,
+		                                 Graph::Version version)
+	{
+		if (!graphs.contains(id) || !graphs.isLoaded(id))
+		{
+			return std::nullopt;
+		}
+
+		const Graph& g = graphs[id];
+		auto lock = std::shared_lock<std::shared_mutex>(g.getMutex());
+
+		return (g.getVersion() == version) ?
+			   std::optional<std::uint64_t>(computeContentHashOf(g)) :
+			   std::nullopt;
+	}
+}
\ No newline at end of file
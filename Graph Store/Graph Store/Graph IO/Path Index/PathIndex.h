@@ -0,0 +1,104 @@
+#ifndef __PATH_INDEX_HEADER_INCLUDED__
+#define __PATH_INDEX_HEADER_INCLUDED__
+
+#include "Shortest Path Algorithms/Path Cache/PathCache.h"
+#include "Graph/Abstract class/Graph.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+class GraphCollection;
+
+/*
+	Layout of a path index file (all numbers are little-endian):
+
+	char magic[4]
+	std::uint32_t version
+	std::uint64_t contentHash
+		- the hash of the contents of the graph the paths were found in
+	std::uint64_t entriesCount
+	the entries, each one holding the source id, the target id and the
+		algorithm id of a search, the length of the found path
+		(UINT64_MAX if there is no path), the number of vertices on it
+		(std::uint32_t) and their ids
+	std::uint64_t checksum
+		- FNV-1a of all the preceding bytes
+
+	Strings are stored as their length (std::uint32_t) followed by their
+	characters.
+*/
+
+namespace GraphIO
+{
+	/*
+		Keeps the cached search results of each graph in a file next to
+		the graph file, so that they are not lost when the program exits.
+		The file is stamped with a hash of the contents of the graph and
+		is ignored once the graph changes.
+		The index does not touch the cache itself, so that its files are
+		read and written without holding the lock of a shared cache.
+		The file of a graph is read and checked against the graph once,
+		when the graph is first searched. Updated results are kept in
+		memory with the version of the graph they were found in until
+		saveChanges is called, and the content hash is computed only then,
+		so searches never hash the whole graph after a change.
+		The index only speeds searches up, so errors while saving are
+		logged rather than thrown.
+	*/
+	class PathIndex
+	{
+	public:
+		using Entries = std::vector<std::pair<PathCache::Query, PathCache::Path>>;
+
+	private:
+		struct Change
+		{
+			Graph::Version version;
+			Entries entries;
+		};
+
+	public:
+		PathIndex() noexcept;
+		PathIndex(const PathIndex&) = delete;
+		PathIndex& operator=(const PathIndex&) = delete;
+
+		Entries load(const Graph& g);
+		void update(const Graph& g, Entries entries);
+		void saveChanges(const GraphCollection& graphs) noexcept;
+		std::size_t getChangesCount() const noexcept;
+
+	private:
+		static std::string encode(const Entries& entries,
+			                      std::uint64_t contentHash);
+		static void write(const String& fileName, const std::string& bytes);
+		static std::optional<std::uint64_t>
+		getContentHashIfUnchanged(const GraphCollection& graphs,
+			                      const String& id,
+			                      Graph::Version version);
+		static bool tryToLoad(const char* data,
+			                  std::size_t size,
+			                  const Graph& g,
+			                  Entries& entries);
+
+	private:
+		bool markAsLoaded(const Graph& g);
+
+	private:
+		static const char MAGIC[4];
+		static const std::uint32_t VERSION = 1;
+
+	private:
+		std::set<String> loadedGraphs;
+		std::map<String, Change> changes;
+		std::size_t changesCount;
+		mutable std::mutex mutex;
+		std::mutex filesMutex;
+	};
+}
+
+#endif //__PATH_INDEX_HEADER_INCLUDED__
\ No newline at end of file
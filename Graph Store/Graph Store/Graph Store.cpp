@@ -1,16 +1,64 @@
 #include "Application/Application.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
+static int printUsage(const char* programName)
+{
+	std::cerr << "Expected a directory!\nUsage: " << programName
+			  << " <directory> [--script <file>] [--stop-on-error] [--no-sync]"
+			  << " [--listen <socket file> | --port <port>]\n";
+	return 1;
+}
+
 int main(int argc, const char* argv[])
 {	
-	if (argc != 2)
+	Application& application = Application::instance();
+	const char* directory = nullptr;
+
+	for (int i = 1; i < argc; ++i)
 	{
-		std::cerr << "Expected one argument: <directory>!\nUsage: "
-				  << argv[0] << '\n';
-		return 1;
+		if (std::strcmp(argv[i], "--script") == 0 && i + 1 < argc)
+		{
+			application.setScript(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--listen") == 0 && i + 1 < argc)
+		{
+			application.listenOn(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+		{
+			int port = std::atoi(argv[++i]);
+
+			if (port <= 0 || port > 65535)
+			{
+				return printUsage(argv[0]);
+			}
+
+			application.listenOnPort(static_cast<std::uint16_t>(port));
+		}
+		else if (std::strcmp(argv[i], "--stop-on-error") == 0)
+		{
+			application.stopOnFirstError();
+		}
+		else if (std::strcmp(argv[i], "--no-sync") == 0)
+		{
+			application.commitJournalInBatches();
+		}
+		else if (directory == nullptr)
+		{
+			directory = argv[i];
+		}
+		else
+		{
+			return printUsage(argv[0]);
+		}
 	}
 
-	Application::instance().runIn(argv[1]);
+	if (directory == nullptr)
+	{
+		return printUsage(argv[0]);
+	}
 
-    return 0;
-}
+	return application.runIn(directory) ? 0 : 1;
+}
\ No newline at end of file
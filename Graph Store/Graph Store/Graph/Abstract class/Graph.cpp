@@ -1,6 +1,9 @@
 #include "Graph.h"
 #include "Graph/Graph Exception/GraphException.h"
 #include "Iterator/ConcreteIteratorAdapter.h"
+#include <iterator>
+
+std::atomic<Graph::Version> Graph::lastVersion{ 0 };
 
 Graph::Vertex::Vertex(String id,
 	                  size_t index,
@@ -23,16 +26,14 @@ void Graph::Vertex::setID(String id)
 	}
 }
 
-void Graph::Vertex::exchangeContentsWith(Vertex& v)
+const String& Graph::Vertex::getID() const
 {
-	std::swap(id, v.id);
-	std::swap(index, v.index);
-	std::swap(iterator, v.iterator);
+	return id;
 }
 
-const String& Graph::Vertex::getID() const
+size_t Graph::Vertex::getIndex() const noexcept
 {
-	return id;
+	return index;
 }
 
 bool operator!=(const Graph::Vertex& lhs, const Graph::Vertex& rhs)
@@ -172,10 +173,21 @@ bool Graph::EdgesConstIteratorBase::operator!() const
 }
 
 Graph::Graph(const String& id) :
-	vertexSearchSet(INITIAL_COLLECTION_SIZE)
+	vertexSearchSet(INITIAL_COLLECTION_SIZE),
+	outgoingEdgesCount(0),
+	nonUnitWeightEdgesCount(0)
 {
 	vertices.reserve(INITIAL_COLLECTION_SIZE);
 	setID(id);
+	updateVersion();
+}
+
+Graph::~Graph()
+{
+	notifyObservers([this](Observer& o)
+	{
+		o.onGraphDestroyed(*this);
+	});
 }
 
 void Graph::setID(String id)
@@ -196,7 +208,12 @@ void Graph::removeVertex(Vertex& v)
 
 	removeEdgesEndingIn(v);
 	removeEdgesLeaving(v);
+	notifyObservers([this, &v](Observer& o)
+	{
+		o.onVertexRemoved(*this, v);
+	});
 	removeVertexFromCollection(v);
+	updateVersion();
 }
 
 void Graph::removeEdgeFromTo(const Vertex& start, const Vertex& end)
@@ -209,7 +226,15 @@ void Graph::removeEdgeFromTo(const Vertex& start, const Vertex& end)
 
 	if (iteratorToEdge)
 	{
+		auto weight = iteratorToEdge->getWeight();
 		getEdgesLeaving(start).removeAt(iteratorToEdge);
+		unregisterEdgeWith(weight);
+		updateVersion();
+
+		notifyObservers([&](Observer& o)
+		{
+			o.onOutgoingEdgeRemoved(*this, start, end, weight);
+		});
 	}
 	else
 	{
@@ -250,10 +275,44 @@ void Graph::removeEdgesLeaving(const Vertex& v)
 {
 	assert(isOwnerOf(v));
 
+	if (hasObservers())
+	{
+		removeEdgesLeavingOneByOne(v);
+	}
+	else
+	{
+		unregisterEdgesLeaving(v);
+	}
+
 	AdjacencyListsIterator iterator = v.iterator;
 	adjacencyLists.removeAt(iterator);
 }
 
+void Graph::removeEdgesLeavingOneByOne(const Vertex& v)
+{
+	assert(isOwnerOf(v));
+
+	const AdjacencyList& edges = getEdgesLeaving(v);
+
+	while (!edges.isEmpty())
+	{
+		removeEdgeFromTo(v, edges.getFirst().getEnd());
+	}
+}
+
+void Graph::unregisterEdgesLeaving(const Vertex& v) noexcept
+{
+	assert(isOwnerOf(v));
+
+	OutgoingEdgesConcreteConstIterator iterator =
+		getConcreteConstIteratorOfEdgesLeaving(v);
+
+	forEach(iterator, [this](const OutgoingEdge& e)
+	{
+		unregisterEdgeWith(e.getWeight());
+	});
+}
+
 void Graph::removeVertexFromCollection(Vertex& v)
 {
 	assert(isOwnerOf(v));
@@ -261,14 +320,10 @@ void Graph::removeVertexFromCollection(Vertex& v)
 	vertexSearchSet.remove(v.id);
 	
 	size_t indexOfLastVertex = getVerticesCount() - 1;
-	vertexSearchSet.remove(vertices[indexOfLastVertex].id);
-	
 	size_t indexToRemoveAt = v.index;
-	vertices[indexOfLastVertex].index = indexToRemoveAt;
-	vertices[indexToRemoveAt].exchangeContentsWith(vertices[indexOfLastVertex]);
+	vertices[indexOfLastVertex]->index = indexToRemoveAt;
+	std::swap(vertices[indexToRemoveAt], vertices[indexOfLastVertex]);
 	vertices.pop_back();
-
-	vertexSearchSet.add(vertices[indexToRemoveAt]);
 }
 
 void Graph::addVertex(const String& id)
@@ -283,12 +338,114 @@ void Graph::addVertex(const String& id)
 	}
 }
 
+/*
+	A graph that is being built has no observers yet, so the vertices and
+	edges are appended without notifying anyone and the version is updated
+	once at the end.
+*/
+void Graph::addVerticesAndEdges(const std::vector<String>& vertexIDs,
+	                            const std::vector<IndexedEdge>& edges)
+{
+	assert(!hasObservers());
+
+	verifyHasNoVertices();
+	verifyIndicesOf(edges, vertexIDs.size());
+	verifyNoDuplicatesAmong(edges);
+	reserveCapacityFor(vertexIDs.size());
+	addVertices(vertexIDs);
+	addVerifiedEdges(edges);
+	updateVersion();
+}
+
+void Graph::verifyHasNoVertices() const
+{
+	if (getVerticesCount() != 0)
+	{
+		throw GraphException("Expected a graph without vertices!"_s);
+	}
+}
+
+void Graph::verifyIndicesOf(const std::vector<IndexedEdge>& edges,
+	                        std::size_t verticesCount) const
+{
+	auto hasValidIndices = [verticesCount](const IndexedEdge& e)
+	{
+		return e.startIndex < verticesCount && e.endIndex < verticesCount;
+	};
+
+	if (!std::all_of(edges.cbegin(), edges.cend(), hasValidIndices))
+	{
+		throw GraphException("Invalid vertex index in an edge!"_s);
+	}
+}
+
+void Graph::verifyNoDuplicatesAmong(const std::vector<IndexedEdge>& edges) const
+{
+	auto keys = std::vector<EdgeKey>();
+	keys.reserve(edges.size());
+
+	std::transform(edges.cbegin(),
+		           edges.cend(),
+		           std::back_inserter(keys),
+		           [this](const IndexedEdge& e) { return getVerifiedKeyOf(e); });
+	std::sort(keys.begin(), keys.end());
+
+	if (std::adjacent_find(keys.cbegin(), keys.cend()) != keys.cend())
+	{
+		throw GraphException("There already is such an edge in the graph!"_s);
+	}
+}
+
+Graph::EdgeKey Graph::getVerifiedKeyOf(const IndexedEdge& e) const
+{
+	return { e.startIndex, e.endIndex };
+}
+
+void Graph::reserveCapacityFor(std::size_t verticesCount)
+{
+	assert(getVerticesCount() == 0);
+
+	vertices.reserve(verticesCount);
+	vertexSearchSet = Hash(verticesCount);
+}
+
+void Graph::addVertices(const std::vector<String>& ids)
+{
+	std::for_each(ids.cbegin(), ids.cend(), [this](const String& id)
+	{
+		if (hasVertexWithID(id))
+		{
+			throw GraphException("There already is a vertex with id: " + id);
+		}
+
+		appendVertex(id);
+	});
+}
+
+void Graph::addVerifiedEdges(const std::vector<IndexedEdge>& edges)
+{
+	std::for_each(edges.cbegin(), edges.cend(), [this](const IndexedEdge& e)
+	{
+		addVerifiedEdge(*vertices[e.startIndex], *vertices[e.endIndex], e.weight);
+	});
+}
+
 bool Graph::hasVertexWithID(const String& id) const
 {
 	return vertexSearchSet.contains(id);
 }
 
 void Graph::tryToAddNewVertex(const String& id)
+{
+	appendVertex(id);
+	updateVersion();
+	notifyObservers([this](Observer& o)
+	{
+		o.onVertexAdded(*this, *vertices.back());
+	});
+}
+
+void Graph::appendVertex(const String& id)
 {
 	try
 	{
@@ -334,11 +491,11 @@ void Graph::addVertexToCollection(const Vertex& v)
 
 	try
 	{
-		vertices.push_back(v);
+		vertices.push_back(std::make_unique<Vertex>(v));
 
 		try
 		{
-			vertexSearchSet.add(vertices.back());
+			vertexSearchSet.add(*vertices.back());
 		}
 		catch (std::bad_alloc&)
 		{
@@ -368,6 +525,21 @@ Graph::Vertex& Graph::getVertexWithID(const String& id)
 void Graph::addEdgeFromTo(const Vertex& start,
 						  Vertex& end,
 						  OutgoingEdge::Weight weight)
+{
+	appendEdgeFromTo(start, end, weight);
+	updateVersion();
+	notifyObservers([&](Observer& o)
+	{
+		o.onOutgoingEdgeAdded(*this, start, end, weight);
+	});
+}
+
+/*
+	Adds the edge without updating the version or notifying the observers.
+*/
+void Graph::appendEdgeFromTo(const Vertex& start,
+							 Vertex& end,
+							 OutgoingEdge::Weight weight)
 {
 	assert(isOwnerOf(start));
 	assert(isOwnerOf(end));
@@ -380,6 +552,8 @@ void Graph::addEdgeFromTo(const Vertex& start,
 	{
 		throw GraphException("Not enough memory!"_s);
 	}
+
+	registerEdgeWith(weight);
 }
 
 Graph::VerticesConstIterator
@@ -449,7 +623,7 @@ void Graph::verifyOwnershipOf(const Vertex& v) const
 
 bool Graph::isOwnerOf(const Vertex& v) const
 {
-	return v.index < getVerticesCount() && vertices[v.index] == v;
+	return v.index < getVerticesCount() && *vertices[v.index] == v;
 }
 
 Graph::AdjacencyList&
@@ -475,17 +649,84 @@ unsigned Graph::getVerticesCount() const
 
 unsigned Graph::getEdgesCount() const
 {
-	unsigned count = 0;
+	return outgoingEdgesCount;
+}
+
+bool Graph::hasOnlyUnitWeights() const noexcept
+{
+	return nonUnitWeightEdgesCount == 0;
+}
 
-	forEach(adjacencyLists.getConstIterator(), [&](const AdjacencyList& edges)
+void Graph::registerEdgeWith(OutgoingEdge::Weight weight) noexcept
+{
+	if (weight != 1)
 	{
-		count += edges.getSize();
-	});
+		++nonUnitWeightEdgesCount;
+	}
+
+	++outgoingEdgesCount;
+}
+
+void Graph::unregisterEdgeWith(OutgoingEdge::Weight weight) noexcept
+{
+	if (weight != 1)
+	{
+		assert(nonUnitWeightEdgesCount > 0);
+		--nonUnitWeightEdgesCount;
+	}
 
-	return count;
+	--outgoingEdgesCount;
 }
 
 const String& Graph::getID() const
 {
 	return id;
 }
+
+/*
+	Observers may be added and removed by searches that run along with
+	each other, so the list of observers has a lock of its own.
+*/
+void Graph::addObserver(Observer& o) const
+{
+	auto lock = std::lock_guard<std::mutex>(observersMutex);
+
+	if (std::find(observers.cbegin(), observers.cend(), &o) == observers.cend())
+	{
+		observers.push_back(&o);
+	}
+}
+
+void Graph::removeObserver(Observer& o) const
+{
+	auto lock = std::lock_guard<std::mutex>(observersMutex);
+
+	observers.erase(std::remove(observers.begin(), observers.end(), &o),
+		            observers.end());
+}
+
+bool Graph::hasObservers() const noexcept
+{
+	auto lock = std::lock_guard<std::mutex>(observersMutex);
+
+	return !observers.empty();
+}
+
+/*
+	The lock that commands hold while they read (shared) or change
+	(exclusive) the graph.
+*/
+std::shared_mutex& Graph::getMutex() const noexcept
+{
+	return mutex;
+}
+
+Graph::Version Graph::getVersion() const noexcept
+{
+	return version;
+}
+
+void Graph::updateVersion() noexcept
+{
+	version = ++lastVersion;
+}
\ No newline at end of file
@@ -4,11 +4,16 @@
 #include "String/String.h"
 #include "Iterator/Iterator.h"
 #include "Iterator/STLIteratorAdapter.h"
+#include "Iterator/PointerIteratorAdapter.h"
 #include "Hash/Hash.h"
 #include "Hash/Identifier Accessor/IdentifierAccessor.h"
 #include "Linked List/LinkedList.h"
+#include <atomic>
 #include <memory>
 #include <vector>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
 
 class Graph
 {
@@ -70,11 +75,11 @@ public:
 		~Vertex() = default;
 
 		const String& getID() const;
+		size_t getIndex() const noexcept;
 
 	private:
 		Vertex(String id, size_t index, const AdjacencyListsIterator& iterator);
 		void setID(String id);
-		void exchangeContentsWith(Vertex& v);
 
 	private:
 		String id;
@@ -82,16 +87,48 @@ public:
 		AdjacencyListsIterator iterator;
 	};
 
+	class Observer
+	{
+	public:
+		virtual ~Observer() = default;
+
+		virtual void onVertexAdded(const Graph& g, const Vertex& v) = 0;
+		virtual void onVertexRemoved(const Graph& g, const Vertex& v) = 0;
+		virtual void onOutgoingEdgeAdded(const Graph& g,
+			                             const Vertex& start,
+			                             const Vertex& end,
+			                             OutgoingEdge::Weight weight) = 0;
+		virtual void onOutgoingEdgeRemoved(const Graph& g,
+			                               const Vertex& start,
+			                               const Vertex& end,
+			                               OutgoingEdge::Weight weight) = 0;
+		virtual void onGraphDestroyed(const Graph& g) = 0;
+
+	protected:
+		Observer() = default;
+		Observer(const Observer&) = default;
+		Observer& operator=(const Observer&) = default;
+	};
+
+	struct IndexedEdge
+	{
+		std::size_t startIndex;
+		std::size_t endIndex;
+		Edge::Weight weight;
+	};
+
+	using Version = unsigned long long;
 	using VerticesConstIterator = std::unique_ptr<ConstIterator<Vertex>>;
 	using OutgoingEdgesConstIterator = std::unique_ptr<ConstIterator<OutgoingEdge>>;
 
 private:
 	using Hash = Hash<Vertex, String, IdentifierAccessor>;
-	using Array = std::vector<Vertex>;
+	using Array = std::vector<std::unique_ptr<Vertex>>;
+	using Observers = std::vector<Observer*>;
 
 protected:
-	using VerticesConcreteIterator = STLIteratorAdapter<Array::iterator>;
-	using VerticesConcreteConstIterator = STLConstIteratorAdapter<Array::const_iterator>;
+	using VerticesConcreteIterator = PointerIteratorAdapter<Array::iterator>;
+	using VerticesConcreteConstIterator = PointerConstIteratorAdapter<Array::const_iterator>;
 	using OutgoingEdgesConcreteIterator = AdjacencyList::Iterator;
 	using OutgoingEdgesConcreteConstIterator = AdjacencyList::ConstIterator;
 
@@ -129,9 +166,11 @@ public:
 	using EdgesConstIterator = std::unique_ptr<EdgesConstIteratorBase>;
 
 public:
-	virtual ~Graph() = default;
+	virtual ~Graph();
 
 	void addVertex(const String& id);
+	void addVerticesAndEdges(const std::vector<String>& vertexIDs,
+		                     const std::vector<IndexedEdge>& edges);
 	void removeVertex(Vertex& v);
 	virtual void addEdge(Vertex& start, Vertex& end, Edge::Weight weight) = 0;
 	virtual void removeEdge(const Vertex& start, const Vertex& end) = 0;
@@ -142,12 +181,21 @@ public:
 	virtual EdgesConstIterator getConstIteratorOfEdges() const = 0;
 	virtual unsigned getEdgesCount() const;
 	unsigned getVerticesCount() const;
+	bool hasOnlyUnitWeights() const noexcept;
 
 	bool hasVertexWithID(const String& id) const;
 	bool hasEdge(const Vertex& start, const Vertex& end) const;
 
 	const String& getID() const;
 	virtual const String& getType() const = 0;
+	Version getVersion() const noexcept;
+
+	void addObserver(Observer& o) const;
+	void removeObserver(Observer& o) const;
+	std::shared_mutex& getMutex() const noexcept;
+
+protected:
+	using EdgeKey = std::pair<std::size_t, std::size_t>;
 
 protected:
 	Graph(const String& id);
@@ -156,6 +204,7 @@ protected:
 
 	void removeEdgeFromTo(const Vertex& start, const Vertex& end);
 	void addEdgeFromTo(const Vertex& start, Vertex& end, OutgoingEdge::Weight weight);
+	void appendEdgeFromTo(const Vertex& start, Vertex& end, OutgoingEdge::Weight weight);
 	void verifyNoSuchEdgeExists(const Vertex& start, const Vertex& end) const;
 	void verifyOwnershipOf(const Vertex& v) const;
 	bool isOwnerOf(const Vertex& v) const;
@@ -168,8 +217,26 @@ protected:
 
 private:
 	virtual void removeEdgesEndingIn(const Vertex& v) = 0;
+	virtual void addVerifiedEdge(Vertex& start, Vertex& end, Edge::Weight weight) = 0;
+	virtual EdgeKey getVerifiedKeyOf(const IndexedEdge& e) const;
+	void verifyHasNoVertices() const;
+	void verifyIndicesOf(const std::vector<IndexedEdge>& edges,
+		                 std::size_t verticesCount) const;
+	void verifyNoDuplicatesAmong(const std::vector<IndexedEdge>& edges) const;
+	void reserveCapacityFor(std::size_t verticesCount);
+	void addVertices(const std::vector<String>& ids);
+	void addVerifiedEdges(const std::vector<IndexedEdge>& edges);
 	virtual void removeEdgesLeaving(const Vertex& v);
+	void removeEdgesLeavingOneByOne(const Vertex& v);
+	void unregisterEdgesLeaving(const Vertex& v) noexcept;
+	void registerEdgeWith(OutgoingEdge::Weight weight) noexcept;
+	void unregisterEdgeWith(OutgoingEdge::Weight weight) noexcept;
+	bool hasObservers() const noexcept;
+	void updateVersion() noexcept;
+	template <class Function>
+	void notifyObservers(Function f) const;
 	void tryToAddNewVertex(const String& id);
+	void appendVertex(const String& id);
 	void addVertexToCollection(const Vertex& v);
 	void removeVertexFromCollection(Vertex& v);
 	OutgoingEdgesConcreteIterator searchForEdgeFromTo(const Vertex& start, const Vertex& end);
@@ -182,12 +249,19 @@ private:
 
 private:
 	static const size_t INITIAL_COLLECTION_SIZE = 16;
+	static std::atomic<Version> lastVersion;
 
 private:
 	String id;
 	Array vertices;
 	LinkedList<AdjacencyList> adjacencyLists;
 	Hash vertexSearchSet;
+	mutable Observers observers;
+	mutable std::mutex observersMutex;
+	mutable std::shared_mutex mutex;
+	Version version;
+	unsigned outgoingEdgesCount;
+	unsigned nonUnitWeightEdgesCount;
 };
 
 bool operator==(const Graph::Vertex& lhs, const Graph::Vertex& rhs);
@@ -206,4 +280,23 @@ Graph::createConstIteratorOfEdges() const
 	return std::make_unique<ConcreteIterator>(verticesIterator, edgesIterator);
 }
 
+template <class Function>
+void Graph::notifyObservers(Function f) const
+{
+	auto observersToNotify = Observers{};
+
+	{
+		auto lock = std::lock_guard<std::mutex>(observersMutex);
+		observersToNotify = observers;
+	}
+
+	std::for_each(observersToNotify.cbegin(),
+		          observersToNotify.cend(),
+		          [&f](Observer* o)
+	{
+		assert(o != nullptr);
+		f(*o);
+	});
+}
+
 #endif //__GRAPH_HEADER_INCLUDED__
\ No newline at end of file
@@ -19,6 +19,13 @@ void DirectedGraph::addEdge(Vertex& start,
 	addEdgeFromTo(start, end, weight);
 }
 
+void DirectedGraph::addVerifiedEdge(Vertex& start,
+									Vertex& end,
+									Edge::Weight weight)
+{
+	appendEdgeFromTo(start, end, weight);
+}
+
 void DirectedGraph::removeEdge(const Vertex& start,
 							   const Vertex& end)
 {
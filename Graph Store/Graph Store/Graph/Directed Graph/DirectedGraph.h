@@ -32,6 +32,7 @@ public:
 
 private:
 	virtual void removeEdgesEndingIn(const Vertex& v) override;
+	virtual void addVerifiedEdge(Vertex& start, Vertex& end, Edge::Weight weight) override;
 };
 
 #endif //__DIRECTED_GRAPH_HEADER_INCLUDED__
\ No newline at end of file
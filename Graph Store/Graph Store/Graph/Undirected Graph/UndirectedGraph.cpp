@@ -49,6 +49,24 @@ void UndirectedGraph::tryToAddUndirectedEdge(Vertex& start,
 	}
 }
 
+void UndirectedGraph::addVerifiedEdge(Vertex& start,
+									  Vertex& end,
+									  Edge::Weight weight)
+{
+	appendEdgeFromTo(start, end, weight);
+	appendEdgeFromTo(end, start, weight);
+}
+
+Graph::EdgeKey UndirectedGraph::getVerifiedKeyOf(const IndexedEdge& e) const
+{
+	if (e.startIndex == e.endIndex)
+	{
+		throw GraphException("Proposed edge is a loop!"_s);
+	}
+
+	return std::minmax(e.startIndex, e.endIndex);
+}
+
 void UndirectedGraph::removeEdge(const Vertex& start, const Vertex& end)
 {
 	verifyOwnershipOf(start);
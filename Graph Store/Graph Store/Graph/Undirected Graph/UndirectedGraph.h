@@ -16,6 +16,8 @@ public:
 
 private:
 	virtual void removeEdgesEndingIn(const Vertex& v) override;
+	virtual void addVerifiedEdge(Vertex& start, Vertex& end, Edge::Weight weight) override;
+	virtual EdgeKey getVerifiedKeyOf(const IndexedEdge& e) const override;
 	void tryToAddUndirectedEdge(Vertex& start, Vertex& end, Edge::Weight weight);
 	void verifyEdgeWouldNotBeALoop(const Vertex& start, const Vertex& end) const;
 };
@@ -0,0 +1,40 @@
+#include "InterruptGuard.h"
+#include <csignal>
+
+std::atomic<bool> InterruptGuard::wasInterrupted(false);
+std::mutex InterruptGuard::mutex;
+std::size_t InterruptGuard::guardsCount = 0;
+InterruptGuard::Handler InterruptGuard::previousHandler = SIG_ERR;
+
+InterruptGuard::InterruptGuard() noexcept
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	if (guardsCount++ == 0)
+	{
+		wasInterrupted = false;
+		previousHandler = std::signal(SIGINT, handleInterruption);
+	}
+}
+
+InterruptGuard::~InterruptGuard()
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	if (--guardsCount == 0 && previousHandler != SIG_ERR)
+	{
+		std::signal(SIGINT, previousHandler);
+	}
+}
+
+void InterruptGuard::handleInterruption(int)
+{
+	wasInterrupted = true;
+	std::signal(SIGINT, handleInterruption);
+}
+
+const std::atomic<bool>&
+InterruptGuard::getInterruptionFlag() const noexcept
+{
+	return wasInterrupted;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef __INTERRUPT_GUARD_HEADER_INCLUDED__
+#define __INTERRUPT_GUARD_HEADER_INCLUDED__
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+/*
+	Catches interruptions (Ctrl+C) while at least one guard exists.
+	Guards may be created by several threads at a time: the first one
+	installs the handler and clears the flag and the last one restores
+	the previous handler.
+*/
+class InterruptGuard
+{
+	using Handler = void (*)(int);
+
+public:
+	InterruptGuard() noexcept;
+	InterruptGuard(const InterruptGuard&) = delete;
+	InterruptGuard& operator=(const InterruptGuard&) = delete;
+	~InterruptGuard();
+
+	const std::atomic<bool>& getInterruptionFlag() const noexcept;
+
+private:
+	static void handleInterruption(int signal);
+
+private:
+	static std::atomic<bool> wasInterrupted;
+	static std::mutex mutex;
+	static std::size_t guardsCount;
+	static Handler previousHandler;
+};
+
+#endif //__INTERRUPT_GUARD_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef __POINTER_ITERATOR_ADAPTER_HEADER_INCLUDED__
+#define __POINTER_ITERATOR_ADAPTER_HEADER_INCLUDED__
+
+#include "Iterator.h"
+#include <assert.h>
+#include <iterator>
+#include <memory>
+
+template <class STLIterator>
+using PointeeOf = typename std::pointer_traits<typename std::iterator_traits<STLIterator>::value_type>::element_type;
+
+template <class STLIterator, bool isConst = false>
+class PointerIteratorAdapter : public AbstractIterator<PointeeOf<STLIterator>, isConst>
+{
+public:
+	using typename AbstractIterator<PointeeOf<STLIterator>, isConst>::Reference;
+
+public:
+	PointerIteratorAdapter(STLIterator rangeStart, STLIterator rangeEnd);
+	PointerIteratorAdapter<STLIterator, isConst>& operator++() override;
+
+protected:
+	bool isValid() const override;
+
+private:
+	Reference getCurrentItem() const override;
+
+private:
+	STLIterator iterator;
+	STLIterator end;
+};
+
+template <class STLConstIterator>
+using PointerConstIteratorAdapter = PointerIteratorAdapter<STLConstIterator, true>;
+
+template <class STLIterator, bool isConst>
+PointerIteratorAdapter<STLIterator, isConst>::PointerIteratorAdapter(STLIterator rangeStart,
+	                                                                 STLIterator rangeEnd) :
+	iterator(rangeStart),
+	end(rangeEnd)
+{
+}
+
+template <class STLIterator, bool isConst>
+PointerIteratorAdapter<STLIterator, isConst>&
+PointerIteratorAdapter<STLIterator, isConst>::operator++()
+{
+	if (isValid())
+	{
+		++iterator;
+	}
+
+	return *this;
+}
+
+template <class STLIterator, bool isConst>
+inline bool PointerIteratorAdapter<STLIterator, isConst>::isValid() const
+{
+	return iterator != end;
+}
+
+template <class STLIterator, bool isConst>
+inline auto
+PointerIteratorAdapter<STLIterator, isConst>::getCurrentItem() const -> Reference
+{
+	assert(isValid());
+	assert(*iterator != nullptr);
+
+	return *(*iterator);
+}
+
+#endif //__POINTER_ITERATOR_ADAPTER_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,232 @@
+#include "MemoryMappedFile.h"
+#include "String/String.h"
+#include "File Parser/Open File Fail Exception/OpenFileFailException.h"
+#include <utility>
+#include <assert.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::MemoryMappedFile() noexcept :
+	data(nullptr),
+	size(0),
+	isOpened(false),
+#ifdef _WIN32
+	fileHandle(INVALID_HANDLE_VALUE),
+	mappingHandle(nullptr)
+#else
+	fileDescriptor(-1)
+#endif
+{
+}
+
+MemoryMappedFile::MemoryMappedFile(const String& fileName) :
+	MemoryMappedFile()
+{
+	open(fileName);
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& source) noexcept :
+	MemoryMappedFile()
+{
+	swapContentsWith(source);
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		close();
+		swapContentsWith(rhs);
+	}
+
+	return *this;
+}
+
+void MemoryMappedFile::swapContentsWith(MemoryMappedFile& file) noexcept
+{
+	std::swap(data, file.data);
+	std::swap(size, file.size);
+	std::swap(isOpened, file.isOpened);
+#ifdef _WIN32
+	std::swap(fileHandle, file.fileHandle);
+	std::swap(mappingHandle, file.mappingHandle);
+#else
+	std::swap(fileDescriptor, file.fileDescriptor);
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	close();
+}
+
+void MemoryMappedFile::open(const String& fileName)
+{
+	close();
+
+	try
+	{
+		map(fileName);
+	}
+	catch (OpenFileFailException&)
+	{
+		close();
+		throw;
+	}
+
+	isOpened = true;
+}
+
+#ifdef _WIN32
+
+void MemoryMappedFile::map(const String& fileName)
+{
+	fileHandle = CreateFileA(fileName.cString(),
+		                     GENERIC_READ,
+		                     FILE_SHARE_READ,
+		                     nullptr,
+		                     OPEN_EXISTING,
+		                     FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		                     nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		throw OpenFileFailException("Could not open: " + fileName);
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if (!GetFileSizeEx(fileHandle, &fileSize))
+	{
+		throw OpenFileFailException("Could not get the size of: " + fileName);
+	}
+
+	size = static_cast<std::size_t>(fileSize.QuadPart);
+
+	if (size == 0)
+	{
+		return;
+	}
+
+	mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mappingHandle == nullptr)
+	{
+		throw OpenFileFailException("Could not map: " + fileName);
+	}
+
+	data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+	if (data == nullptr)
+	{
+		throw OpenFileFailException("Could not map: " + fileName);
+	}
+}
+
+void MemoryMappedFile::close() noexcept
+{
+	if (data != nullptr)
+	{
+		UnmapViewOfFile(data);
+	}
+
+	if (mappingHandle != nullptr)
+	{
+		CloseHandle(mappingHandle);
+	}
+
+	if (fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(fileHandle);
+	}
+
+	data = nullptr;
+	size = 0;
+	isOpened = false;
+	fileHandle = INVALID_HANDLE_VALUE;
+	mappingHandle = nullptr;
+}
+
+#else
+
+void MemoryMappedFile::map(const String& fileName)
+{
+	fileDescriptor = ::open(fileName.cString(), O_RDONLY);
+
+	if (fileDescriptor == -1)
+	{
+		throw OpenFileFailException("Could not open: " + fileName);
+	}
+
+	struct stat status;
+
+	if (fstat(fileDescriptor, &status) == -1)
+	{
+		throw OpenFileFailException("Could not get the size of: " + fileName);
+	}
+
+	size = static_cast<std::size_t>(status.st_size);
+
+	if (size == 0)
+	{
+		return;
+	}
+
+	void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+	if (address == MAP_FAILED)
+	{
+		throw OpenFileFailException("Could not map: " + fileName);
+	}
+
+	data = static_cast<const char*>(address);
+	madvise(address, size, MADV_SEQUENTIAL);
+}
+
+void MemoryMappedFile::close() noexcept
+{
+	if (data != nullptr)
+	{
+		munmap(const_cast<char*>(data), size);
+	}
+
+	if (fileDescriptor != -1)
+	{
+		::close(fileDescriptor);
+	}
+
+	data = nullptr;
+	size = 0;
+	isOpened = false;
+	fileDescriptor = -1;
+}
+
+#endif
+
+bool MemoryMappedFile::isOpen() const noexcept
+{
+	return isOpened;
+}
+
+const char* MemoryMappedFile::getData() const noexcept
+{
+	assert(isOpen());
+
+	return data;
+}
+
+std::size_t MemoryMappedFile::getSize() const noexcept
+{
+	assert(isOpen());
+
+	return size;
+}
\ No newline at end of file
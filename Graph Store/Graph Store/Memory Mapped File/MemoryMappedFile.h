@@ -0,0 +1,42 @@
+#ifndef __MEMORY_MAPPED_FILE_HEADER_INCLUDED__
+#define __MEMORY_MAPPED_FILE_HEADER_INCLUDED__
+
+#include <cstddef>
+
+class String;
+
+class MemoryMappedFile
+{
+public:
+	MemoryMappedFile() noexcept;
+	explicit MemoryMappedFile(const String& fileName);
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+	MemoryMappedFile(MemoryMappedFile&& source) noexcept;
+	MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+	~MemoryMappedFile();
+
+	void open(const String& fileName);
+	void close() noexcept;
+	bool isOpen() const noexcept;
+
+	const char* getData() const noexcept;
+	std::size_t getSize() const noexcept;
+
+private:
+	void map(const String& fileName);
+	void swapContentsWith(MemoryMappedFile& file) noexcept;
+
+private:
+	const char* data;
+	std::size_t size;
+	bool isOpened;
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#else
+	int fileDescriptor;
+#endif
+};
+
+#endif //__MEMORY_MAPPED_FILE_HEADER_INCLUDED__
\ No newline at end of file
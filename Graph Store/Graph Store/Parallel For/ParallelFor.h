@@ -0,0 +1,136 @@
+#ifndef __PARALLEL_FOR_HEADER_INCLUDED__
+#define __PARALLEL_FOR_HEADER_INCLUDED__
+
+#include "Thread Pool/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+inline std::size_t getWorkersCountFor(std::size_t tasksCount)
+{
+	auto hardwareThreads =
+		std::max(std::thread::hardware_concurrency(), 1u);
+
+	return std::min<std::size_t>(hardwareThreads, tasksCount);
+}
+
+/*
+	The threads that help the callers of parallelFor. They are shared by
+	all calls, so loads that run along with each other or inside one
+	another do not start more threads than the hardware runs.
+*/
+inline ThreadPool& getParallelForPool()
+{
+	static ThreadPool pool(
+		getWorkersCountFor(std::numeric_limits<std::size_t>::max()) - 1);
+
+	return pool;
+}
+
+/*
+	Calls f(i) for every i in [0, count) on the calling thread and on the
+	threads of the shared pool that are free. The calling thread waits only
+	for the helpers that have started, so calls made on pool threads never
+	wait for queued tasks.
+	If any of the calls throws, no new calls are started and the first
+	exception is rethrown once every thread has finished.
+*/
+template <class Function>
+void parallelFor(std::size_t count, Function f)
+{
+	struct Loop
+	{
+		std::atomic<std::size_t> nextIndex{ 0 };
+		std::atomic<bool> hasFailed{ false };
+		std::exception_ptr firstException;
+		std::mutex mutex;
+		std::condition_variable helpersHaveFinished;
+		std::size_t helpersCount = 0;
+		bool isClosed = false;
+	};
+
+	auto loop = std::make_shared<Loop>();
+
+	auto work = [&f, &loop, count]()
+	{
+		for (auto i = loop->nextIndex++;
+			 i < count && !loop->hasFailed;
+			 i = loop->nextIndex++)
+		{
+			try
+			{
+				f(i);
+			}
+			catch (...)
+			{
+				auto lock = std::lock_guard<std::mutex>{ loop->mutex };
+
+				if (!loop->hasFailed.exchange(true))
+				{
+					loop->firstException = std::current_exception();
+				}
+			}
+		}
+	};
+
+	auto help = [loop, &work]()
+	{
+		{
+			auto lock = std::lock_guard<std::mutex>{ loop->mutex };
+
+			if (loop->isClosed)
+			{
+				return;
+			}
+
+			++loop->helpersCount;
+		}
+
+		work();
+
+		{
+			auto lock = std::lock_guard<std::mutex>{ loop->mutex };
+			--loop->helpersCount;
+		}
+
+		loop->helpersHaveFinished.notify_all();
+	};
+
+	ThreadPool& pool = getParallelForPool();
+	auto helpersCount =
+		std::min(pool.getWorkersCount(), count > 0 ? count - 1 : 0);
+
+	for (auto i = std::size_t{ 0 }; i < helpersCount; ++i)
+	{
+		try
+		{
+			pool.submit(help);
+		}
+		catch (std::exception&)
+		{
+			break;
+		}
+	}
+
+	work();
+
+	auto lock = std::unique_lock<std::mutex>{ loop->mutex };
+	loop->isClosed = true;
+	loop->helpersHaveFinished.wait(lock, [&loop]()
+	{
+		return loop->helpersCount == 0;
+	});
+
+	if (loop->firstException)
+	{
+		std::rethrow_exception(loop->firstException);
+	}
+}
+
+#endif //__PARALLEL_FOR_HEADER_INCLUDED__
\ No newline at end of file
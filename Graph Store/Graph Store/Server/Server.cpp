@@ -0,0 +1,188 @@
+#include "Server.h"
+#include <exception>
+#include <assert.h>
+
+const std::chrono::milliseconds Server::ACCEPT_TIMEOUT(200);
+
+Server::Connection::Connection(Socket socket) :
+	socket(std::move(socket)),
+	session(output),
+	isFinished(false)
+{
+}
+
+Server::Server(Executor executor) :
+	executor(std::move(executor)),
+	isStopRequested(false)
+{
+}
+
+Server::~Server()
+{
+	stop();
+}
+
+void Server::start(Socket listener)
+{
+	assert(!isRunning());
+
+	this->listener = std::move(listener);
+	isStopRequested = false;
+	acceptor = std::thread([this]() noexcept { acceptConnections(); });
+}
+
+void Server::stop() noexcept
+{
+	if (isRunning())
+	{
+		isStopRequested = true;
+		acceptor.join();
+		closeConnections();
+		listener.close();
+	}
+}
+
+bool Server::isRunning() const noexcept
+{
+	return acceptor.joinable();
+}
+
+void Server::acceptConnections() noexcept
+{
+	while (!isStopRequested)
+	{
+		try
+		{
+			if (listener.waitForConnection(ACCEPT_TIMEOUT))
+			{
+				acceptConnection();
+			}
+
+			removeFinishedConnections();
+		}
+		catch (std::exception&)
+		{
+		}
+	}
+}
+
+void Server::acceptConnection()
+{
+	auto connection = std::make_unique<Connection>(listener.accept());
+	Connection& newConnection = *connection;
+	newConnection.thread = std::thread([this, &newConnection]() noexcept
+	{
+		serve(newConnection);
+	});
+
+	auto lock = std::lock_guard<std::mutex>(connectionsMutex);
+	connections.push_back(std::move(connection));
+}
+
+void Server::serve(Connection& connection) noexcept
+{
+	auto buffer = std::string{};
+	char received[RECEIVE_BUFFER_SIZE];
+
+	try
+	{
+		while (!connection.session.hasEnded())
+		{
+			auto lineEnd = buffer.find('\n');
+			auto lineLength = (lineEnd != std::string::npos) ? lineEnd : buffer.size();
+
+			if (lineLength > MAX_LINE_LENGTH)
+			{
+				sendReply(connection.socket,
+					      "error",
+					      "Command lines must not be longer than "
+					      + std::to_string(MAX_LINE_LENGTH) + " bytes!");
+				break;
+			}
+
+			if (lineEnd != std::string::npos)
+			{
+				auto commandLine = buffer.substr(0, lineEnd);
+				buffer.erase(0, lineEnd + 1);
+				execute(connection, commandLine);
+				continue;
+			}
+
+			auto size = connection.socket.receive(received, RECEIVE_BUFFER_SIZE);
+
+			if (size == 0)
+			{
+				break;
+			}
+
+			buffer.append(received, size);
+		}
+	}
+	catch (std::exception&)
+	{
+	}
+
+	connection.socket.shutdown();
+	connection.isFinished = true;
+}
+
+void Server::execute(Connection& connection, std::string& commandLine)
+{
+	if (!commandLine.empty() && commandLine.back() == '\r')
+	{
+		commandLine.pop_back();
+	}
+
+	connection.output.str("");
+
+	try
+	{
+		executor(connection.session, commandLine.data());
+		sendReply(connection.socket, "ok", connection.output.str());
+	}
+	catch (std::exception& e)
+	{
+		sendReply(connection.socket, "error", e.what());
+	}
+}
+
+void Server::sendReply(const Socket& socket,
+	                   const char* status,
+	                   const std::string& body)
+{
+	auto reply = std::string(status) + ' ' + std::to_string(body.size()) + '\n' + body;
+	socket.send(reply.data(), reply.size());
+}
+
+void Server::removeFinishedConnections()
+{
+	auto lock = std::lock_guard<std::mutex>(connectionsMutex);
+
+	connections.remove_if([](ConnectionPointer& connection)
+	{
+		if (connection->isFinished)
+		{
+			connection->thread.join();
+			return true;
+		}
+
+		return false;
+	});
+}
+
+void Server::closeConnections() noexcept
+{
+	auto lock = std::lock_guard<std::mutex>(connectionsMutex);
+
+	for (auto& connection : connections)
+	{
+		connection->socket.shutdown();
+	}
+
+	for (auto& connection : connections)
+	{
+		connection->thread.join();
+	}
+
+	connections.clear();
+}
\ No newline at end of file
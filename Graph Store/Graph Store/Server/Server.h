@@ -0,0 +1,80 @@
+#ifndef __SERVER_HEADER_INCLUDED__
+#define __SERVER_HEADER_INCLUDED__
+
+#include "Socket/Socket.h"
+#include "Session/Session.h"
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/*
+	Serves clients that connect to a listening socket. Each connection has
+	its own session and thread and sends one command per line. The
+	commands are executed on the thread of their connection and every
+	command gets a reply made of a status line, "ok <size>" or
+	"error <size>", followed by that many bytes of output or of the error
+	message. A line longer than MAX_LINE_LENGTH is answered with an error
+	and ends the connection.
+*/
+class Server
+{
+public:
+	using Executor = std::function<void(Session&, char* commandLine)>;
+
+private:
+	struct Connection
+	{
+		explicit Connection(Socket socket);
+
+		Socket socket;
+		std::ostringstream output;
+		Session session;
+		std::thread thread;
+		std::atomic<bool> isFinished;
+	};
+
+	using ConnectionPointer = std::unique_ptr<Connection>;
+
+public:
+	explicit Server(Executor executor);
+	Server(const Server&) = delete;
+	Server& operator=(const Server&) = delete;
+	~Server();
+
+	void start(Socket listener);
+	void stop() noexcept;
+	bool isRunning() const noexcept;
+
+private:
+	static void sendReply(const Socket& socket,
+		                  const char* status,
+		                  const std::string& body);
+
+private:
+	void acceptConnections() noexcept;
+	void acceptConnection();
+	void serve(Connection& connection) noexcept;
+	void execute(Connection& connection, std::string& commandLine);
+	void removeFinishedConnections();
+	void closeConnections() noexcept;
+
+private:
+	static const std::chrono::milliseconds ACCEPT_TIMEOUT;
+	static const std::size_t RECEIVE_BUFFER_SIZE = 4096;
+	static const std::size_t MAX_LINE_LENGTH = 1 << 20;
+
+private:
+	Executor executor;
+	Socket listener;
+	std::thread acceptor;
+	std::atomic<bool> isStopRequested;
+	std::mutex connectionsMutex;
+	std::list<ConnectionPointer> connections;
+};
+
+#endif //__SERVER_HEADER_INCLUDED__
\ No newline at end of file
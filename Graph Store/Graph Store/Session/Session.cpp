@@ -0,0 +1,59 @@
+#include "Session.h"
+#include <assert.h>
+
+thread_local Session* Session::currentSession = nullptr;
+
+Session::Session(std::ostream& output) noexcept :
+	output(output),
+	isEnded(false)
+{
+}
+
+Session& Session::current() noexcept
+{
+	assert(currentSession != nullptr);
+
+	return *currentSession;
+}
+
+void Session::makeCurrent() noexcept
+{
+	currentSession = this;
+}
+
+std::ostream& Session::getOutput() noexcept
+{
+	return output;
+}
+
+bool Session::hasUsedGraph() const noexcept
+{
+	return usedGraphID.has_value();
+}
+
+const String& Session::getUsedGraphID() const noexcept
+{
+	assert(hasUsedGraph());
+
+	return *usedGraphID;
+}
+
+void Session::useGraph(const String& id)
+{
+	usedGraphID = id;
+}
+
+void Session::useNoGraph() noexcept
+{
+	usedGraphID.reset();
+}
+
+void Session::end() noexcept
+{
+	isEnded = true;
+}
+
+bool Session::hasEnded() const noexcept
+{
+	return isEnded;
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef __SESSION_HEADER_INCLUDED__
+#define __SESSION_HEADER_INCLUDED__
+
+#include "String/String.h"
+#include <optional>
+#include <ostream>
+
+/*
+	The state of one user of the store: the id of the graph it uses, the
+	stream its commands print to and whether it has ended. Commands are
+	executed on behalf of the current session of the calling thread.
+*/
+class Session
+{
+public:
+	explicit Session(std::ostream& output) noexcept;
+	Session(const Session&) = delete;
+	Session& operator=(const Session&) = delete;
+
+	static Session& current() noexcept;
+
+	void makeCurrent() noexcept;
+	std::ostream& getOutput() noexcept;
+
+	bool hasUsedGraph() const noexcept;
+	const String& getUsedGraphID() const noexcept;
+	void useGraph(const String& id);
+	void useNoGraph() noexcept;
+
+	void end() noexcept;
+	bool hasEnded() const noexcept;
+
+private:
+	static thread_local Session* currentSession;
+
+private:
+	std::ostream& output;
+	std::optional<String> usedGraphID;
+	bool isEnded;
+};
+
+#endif //__SESSION_HEADER_INCLUDED__
\ No newline at end of file
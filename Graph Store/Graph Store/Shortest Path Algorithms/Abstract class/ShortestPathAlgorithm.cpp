@@ -2,6 +2,7 @@
 #include "Invocer/Invocer.h"
 #include <algorithm>
 #include <stdexcept>
+#include <cmath>
 
 ShortestPathAlgorithm::Path::Path(const DecoratedVertex& source,
 	                              const DecoratedVertex& target) :
@@ -13,6 +14,13 @@ ShortestPathAlgorithm::Path::Path(const DecoratedVertex& source,
 	}
 }
 
+ShortestPathAlgorithm::Path::Path(std::forward_list<String> ids,
+	                              Distance length) :
+	ids(std::move(ids)),
+	length(length)
+{
+}
+
 bool ShortestPathAlgorithm::Path::existsPathBetween(const DecoratedVertex& source,
 													const DecoratedVertex& target)
 {
@@ -70,6 +78,17 @@ void ShortestPathAlgorithm::Path::print(std::ostream& out) const
 	printLength(out);
 }
 
+const std::forward_list<String>&
+ShortestPathAlgorithm::Path::getIDs() const noexcept
+{
+	return ids;
+}
+
+const Distance& ShortestPathAlgorithm::Path::getLength() const noexcept
+{
+	return length;
+}
+
 void ShortestPathAlgorithm::Path::printIDs(std::ostream& out) const
 {
 	if (!ids.empty())
@@ -116,12 +135,31 @@ void ShortestPathAlgorithm::setID(String id)
 ShortestPathAlgorithm::Path
 ShortestPathAlgorithm::findShortestPath(const Graph& graph,
 										const Graph::Vertex& source,
-										const Graph::Vertex& target)
+										const Graph::Vertex& target,
+										const SearchBudget& budget)
 {
-	auto resourceReleaser =
-		Invocer{[this]() noexcept { cleanUp(); }};
-	initialise(graph, source, target);
-	execute(graph, source, target);
+	statistics.reset();
+	this->budget = budget;
+	this->budget.start();
+
+	auto resourceReleaser = Invocer{[this]() noexcept
+	{
+		auto timer = SearchStatistics::PhaseTimer{ statistics.cleanUpTime };
+		cleanUp();
+		this->budget = SearchBudget{};
+	}};
+
+	{
+		auto timer = SearchStatistics::PhaseTimer{ statistics.initialisationTime };
+		initialise(graph, source, target);
+	}
+
+	{
+		auto timer = SearchStatistics::PhaseTimer{ statistics.executionTime };
+		execute(graph, source, target);
+	}
+
+	auto timer = SearchStatistics::PhaseTimer{ statistics.pathCreationTime };
 	auto path = createPathBetween(source, target);
 
 	return path;
@@ -142,6 +180,7 @@ void ShortestPathAlgorithm::decorateVerticesOf(const Graph& g)
 	forEach(*iterator, [this](const auto& vertex)
 	{
 		addDecoratedVersionOf(vertex);
+		statistics.countDecoratedVertex();
 	});
 }
 
@@ -155,3 +194,37 @@ const String& ShortestPathAlgorithm::getID() const noexcept
 {
 	return id;
 }
+
+ShortestPathAlgorithm::Cost
+ShortestPathAlgorithm::getInfiniteCost() noexcept
+{
+	return std::numeric_limits<Cost>::infinity();
+}
+
+ShortestPathAlgorithm::Cost
+ShortestPathAlgorithm::estimateCostOfTraversalOf(const Graph& g) noexcept
+{
+	return Cost(g.getVerticesCount()) + Cost(g.getEdgesCount());
+}
+
+ShortestPathAlgorithm::Cost
+ShortestPathAlgorithm::estimateCostOfPriorityFirstTraversalOf(const Graph& g) noexcept
+{
+	return estimateCostOfTraversalOf(g) * std::log2(g.getVerticesCount() + 2.0);
+}
+
+const SearchStatistics&
+ShortestPathAlgorithm::getStatisticsOfLastSearch() const noexcept
+{
+	return statistics;
+}
+
+SearchStatistics& ShortestPathAlgorithm::getStatistics() noexcept
+{
+	return statistics;
+}
+
+SearchBudget& ShortestPathAlgorithm::getBudget() noexcept
+{
+	return budget;
+}
\ No newline at end of file
@@ -4,7 +4,10 @@
 #include "String/String.h"
 #include "Distance/Distance.h"
 #include "Graph/Abstract class/Graph.h"
+#include "../Search Statistics/SearchStatistics.h"
+#include "../Search Budget/SearchBudget.h"
 #include <forward_list>
+#include <limits>
 
 class ShortestPathAlgorithm
 {
@@ -30,12 +33,15 @@ public:
 		friend class ShortestPathAlgorithm;
 
 	public:
+		Path(std::forward_list<String> ids, Distance length);
 		Path(const Path&) = default;
 		Path& operator=(const Path&) = default;
 		Path(Path&& source);
 		Path& operator=(Path&& rhs);
 
 		void print(std::ostream& out) const;
+		const std::forward_list<String>& getIDs() const noexcept;
+		const Distance& getLength() const noexcept;
 
 	private:
 		static bool existsPathBetween(const DecoratedVertex& source,
@@ -55,16 +61,27 @@ public:
 		Distance length;
 	};
 
+	using Cost = double;
+
+public:
+	static Cost getInfiniteCost() noexcept;
+
 public:
 	virtual ~ShortestPathAlgorithm() = default;
 
 	Path findShortestPath(const Graph& g,
 		                  const Graph::Vertex& source,
-		                  const Graph::Vertex& target);
+		                  const Graph::Vertex& target,
+		                  const SearchBudget& budget = SearchBudget{});
 	const String& getID() const noexcept;
+	const SearchStatistics& getStatisticsOfLastSearch() const noexcept;
+	virtual Cost estimateCostOfSearchFrom(const Graph::Vertex& source,
+		                                  const Graph& g) const = 0;
 
 protected:
 	static void initialiseSource(DecoratedVertex& source);
+	static Cost estimateCostOfTraversalOf(const Graph& g) noexcept;
+	static Cost estimateCostOfPriorityFirstTraversalOf(const Graph& g) noexcept;
 
 protected:
 	explicit ShortestPathAlgorithm(String id);
@@ -74,6 +91,8 @@ protected:
 	virtual void addDecoratedVersionOf(const Graph::Vertex& v) = 0;
 	virtual DecoratedVertex& getDecoratedVersionOf(const Graph::Vertex& v) = 0;
 	virtual void decorateVerticesOf(const Graph& g);
+	SearchStatistics& getStatistics() noexcept;
+	SearchBudget& getBudget() noexcept;
 
 private:
 	virtual void initialise(const Graph& g,
@@ -89,6 +108,8 @@ private:
 
 private:
 	String id;
+	SearchStatistics statistics;
+	SearchBudget budget;
 };
 
 std::ostream& operator<<(std::ostream& out,
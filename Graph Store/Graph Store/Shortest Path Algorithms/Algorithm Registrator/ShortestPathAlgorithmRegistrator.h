@@ -2,23 +2,23 @@
 #define __SHORTEST_PATH_ALGORITHM_REGISTRATOR_HEADER_INCLUDED__
 
 #include "../Store/ShortestPathAlgorithmsStore.h"
+#include <memory>
 
 template <class Algorithm>
 class ShortestPathAlgorithmRegistrator
 {
 public:
-	explicit ShortestPathAlgorithmRegistrator(const char* algorithmID) :
-		algorithm(algorithmID)
+	explicit ShortestPathAlgorithmRegistrator(const char* algorithmID)
 	{
-		ShortestPathAlgorithmsStore::instance().addAlgorithm(algorithm);
+		ShortestPathAlgorithmsStore::registerAlgorithm(algorithmID, [algorithmID]()
+		{
+			return std::make_unique<Algorithm>(algorithmID);
+		});
 	}
 
 	ShortestPathAlgorithmRegistrator(const ShortestPathAlgorithmRegistrator&) = delete;
 	ShortestPathAlgorithmRegistrator&
 		operator=(const ShortestPathAlgorithmRegistrator&) = delete;
-
-private:
-	Algorithm algorithm;
 };
 
 #endif //__SHORTEST_PATH_ALGORITHM_REGISTRATOR_HEADER_INCLUDED__
\ No newline at end of file
@@ -10,6 +10,15 @@ BFSShortestPath::BFSShortestPath(String id) :
 {
 }
 
+ShortestPathAlgorithm::Cost
+BFSShortestPath::estimateCostOfSearchFrom(const Graph::Vertex&,
+										  const Graph& g) const
+{
+	return g.hasOnlyUnitWeights() ?
+		   estimateCostOfTraversalOf(g) :
+		   getInfiniteCost();
+}
+
 void BFSShortestPath::initialise(const Graph& graph,
 								 const Graph::Vertex& source,
 								 const Graph::Vertex& target)
@@ -49,6 +58,7 @@ void BFSShortestPath::initialiseSourceAndAddItToFrontier(const Graph::Vertex& so
 void BFSShortestPath::addToFrontier(const MarkableDecoratedVertex& v)
 {
 	frontier.enqueue(&v);
+	getStatistics().countQueuePush();
 }
 
 void BFSShortestPath::prepareTrivialPath(const Graph::Vertex& source)
@@ -85,6 +95,8 @@ void BFSShortestPath::exploreEdgesLeaving(const MarkableDecoratedVertex& v,
 void BFSShortestPath::exploreEdge(const MarkableDecoratedVertex& predecessor,
 								  MarkableDecoratedVertex& successor)
 {
+	getStatistics().countScannedEdge();
+
 	if (successor.isVisited)
 	{
 		return;
@@ -107,6 +119,10 @@ void BFSShortestPath::visitVertex(MarkableDecoratedVertex& v,
 const BFSShortestPath::MarkableDecoratedVertex*
 BFSShortestPath::extractNextVertexFromFrontier()
 {
+	getStatistics().countQueuePop();
+	getStatistics().countSettledVertex();
+	getBudget().spend();
+
 	return frontier.dequeue();
 }
 
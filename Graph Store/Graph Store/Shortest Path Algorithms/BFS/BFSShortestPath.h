@@ -13,6 +13,9 @@ public:
 	BFSShortestPath(const BFSShortestPath&) = delete;
 	BFSShortestPath& operator=(const BFSShortestPath&) = delete;
 
+	Cost estimateCostOfSearchFrom(const Graph::Vertex& source,
+		                          const Graph& g) const override;
+
 private:
 	void initialise(const Graph& g,
 		            const Graph::Vertex& source,
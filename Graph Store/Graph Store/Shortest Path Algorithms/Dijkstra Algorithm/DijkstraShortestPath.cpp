@@ -8,6 +8,13 @@ DijkstraShortestPath::DijkstraShortestPath(String id) :
 {
 }
 
+ShortestPathAlgorithm::Cost
+DijkstraShortestPath::estimateCostOfSearchFrom(const Graph::Vertex&,
+											   const Graph& g) const
+{
+	return estimateCostOfPriorityFirstTraversalOf(g);
+}
+
 void DijkstraShortestPath::initialise(const Graph& g,
 									  const Graph::Vertex& source,
 									  const Graph::Vertex& target)
@@ -41,6 +48,7 @@ void DijkstraShortestPath::gatherDecoratedVerticesWithUndeterminedEstimate()
 	auto end = MapIterator{ decoratedVertices.end() };
 
 	undeterminedEstimateVertices = PriorityQueue(begin, end);
+	getStatistics().countQueuePushes(decoratedVertices.size());
 }
 
 void DijkstraShortestPath::execute(const Graph& g,
@@ -51,6 +59,9 @@ void DijkstraShortestPath::execute(const Graph& g,
 	{
 		auto v =
 			undeterminedEstimateVertices.extractOptimal();
+		getStatistics().countQueuePop();
+		getStatistics().countSettledVertex();
+		getBudget().spend();
 
 		if (*(v->originalVertex) == target)
 		{
@@ -81,12 +92,14 @@ void DijkstraShortestPath::relaxEdge(const DijkstraVertex& start,
 									 Graph::OutgoingEdge::Weight weight)
 {
 	auto distanceThroughStart = start.distanceToSource + weight;
+	getStatistics().countScannedEdge();
 
 	if (distanceThroughStart < end.distanceToSource)
 	{
 		undeterminedEstimateVertices.optimiseKey(end.handle,
 			                                     distanceThroughStart);
 		end.parent = &start;
+		getStatistics().countKeyDecrease();
 	}
 }
 
@@ -99,6 +99,9 @@ public:
 	DijkstraShortestPath(const DijkstraShortestPath&) = delete;
 	DijkstraShortestPath& operator=(const DijkstraShortestPath&) = delete;
 
+	Cost estimateCostOfSearchFrom(const Graph::Vertex& source,
+		                          const Graph& g) const override;
+
 private:
 	void initialise(const Graph& g,
 		            const Graph::Vertex& source,
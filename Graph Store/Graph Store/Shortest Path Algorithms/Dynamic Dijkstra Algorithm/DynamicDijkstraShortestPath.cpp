@@ -0,0 +1,495 @@
+#include "DynamicDijkstraShortestPath.h"
+#include "../Algorithm Registrator/ShortestPathAlgorithmRegistrator.h"
+#include <algorithm>
+#include <assert.h>
+
+static ShortestPathAlgorithmRegistrator<DynamicDijkstraShortestPath> registrator("dynamic-dijkstra");
+
+DynamicDijkstraShortestPath::ShortestPathTree::ShortestPathTree(const Graph& g,
+																const Graph::Vertex& source,
+																const IncomingEdges& incomingEdges,
+																SearchStatistics& statistics,
+																SearchBudget& budget) :
+	graph(g),
+	source(source),
+	incomingEdges(incomingEdges),
+	statistics(&statistics),
+	budget(&budget)
+{
+	build();
+	this->statistics = &statisticsOfRepairs;
+	this->budget = &budgetOfRepairs;
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::build()
+{
+	decoratedVertices.reserve(graph.getVerticesCount());
+
+	auto iterator = graph.getConstIteratorOfVertices();
+
+	forEach(*iterator, [this](const auto& vertex)
+	{
+		addVertex(vertex);
+	});
+
+	auto& decoratedSource = getDecoratedVersionOf(source);
+	initialiseSource(decoratedSource);
+	undeterminedEstimateVertices.add(&decoratedSource);
+	statistics->countQueuePush();
+
+	settleVerticesInQueue();
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::settleVerticesInQueue()
+{
+	while (!undeterminedEstimateVertices.isEmpty())
+	{
+		auto v = undeterminedEstimateVertices.extractOptimal();
+		statistics->countQueuePop();
+		statistics->countSettledVertex();
+		budget->spend();
+
+		relaxEdgesLeaving(*v);
+	}
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::relaxEdgesLeaving(const TreeVertex& v)
+{
+	auto iterator =
+		graph.getConstIteratorOfEdgesLeaving(*(v.originalVertex));
+
+	forEach(*iterator, [this, &v](const auto& edge)
+	{
+		auto& end =
+			getDecoratedVersionOf(edge.getEnd());
+
+		relaxEdge(v, end, edge.getWeight());
+	});
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::relaxEdge(const TreeVertex& start,
+															  TreeVertex& end,
+															  Graph::OutgoingEdge::Weight weight)
+{
+	auto distanceThroughStart = start.distanceToSource + weight;
+	statistics->countScannedEdge();
+
+	if (distanceThroughStart < end.distanceToSource)
+	{
+		lowerEstimateOf(end, distanceThroughStart);
+		end.parent = &start;
+	}
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::lowerEstimateOf(TreeVertex& v,
+																	const Distance& d)
+{
+	if (v.handle.isValid())
+	{
+		undeterminedEstimateVertices.optimiseKey(v.handle, d);
+		statistics->countKeyDecrease();
+	}
+	else
+	{
+		v.distanceToSource = d;
+		undeterminedEstimateVertices.add(&v);
+		statistics->countQueuePush();
+	}
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::addVertex(const Graph::Vertex& v)
+{
+	decoratedVertices.emplace(&v, TreeVertex{ v });
+	statistics->countDecoratedVertex();
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::removeVertex(const Graph::Vertex& v)
+{
+	assert(v != source);
+
+	decoratedVertices.erase(&v);
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::repairAfterAddingEdge(const Graph::Vertex& start,
+																		  const Graph::Vertex& end,
+																		  Graph::OutgoingEdge::Weight weight)
+{
+	relaxEdge(getDecoratedVersionOf(start),
+		      getDecoratedVersionOf(end),
+		      weight);
+	settleVerticesInQueue();
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::repairAfterRemovingEdge(const Graph::Vertex& start,
+																			const Graph::Vertex& end)
+{
+	auto& decoratedEnd = getDecoratedVersionOf(end);
+
+	if (decoratedEnd.parent == &getDecoratedVersionOf(start))
+	{
+		auto subtree = collectSubtreeRootedAt(decoratedEnd);
+		detach(subtree);
+		estimateThroughIncomingEdges(subtree);
+		settleVerticesInQueue();
+	}
+}
+
+std::vector<DynamicDijkstraShortestPath::TreeVertex*>
+DynamicDijkstraShortestPath::ShortestPathTree::collectSubtreeRootedAt(TreeVertex& root)
+{
+	auto subtree = std::vector<TreeVertex*>{ &root };
+
+	for (std::size_t i = 0; i < subtree.size(); ++i)
+	{
+		auto parent = subtree[i];
+		auto iterator =
+			graph.getConstIteratorOfEdgesLeaving(*(parent->originalVertex));
+
+		forEach(*iterator, [this, parent, &subtree](const auto& edge)
+		{
+			auto& child = getDecoratedVersionOf(edge.getEnd());
+
+			if (child.parent == parent)
+			{
+				subtree.push_back(&child);
+			}
+		});
+	}
+
+	return subtree;
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::detach(const std::vector<TreeVertex*>& subtree) noexcept
+{
+	std::for_each(subtree.cbegin(), subtree.cend(), [](TreeVertex* v)
+	{
+		v->parent = nullptr;
+		v->distanceToSource = Distance::getInfinity();
+	});
+}
+
+void DynamicDijkstraShortestPath::ShortestPathTree::estimateThroughIncomingEdges(const std::vector<TreeVertex*>& subtree)
+{
+	std::for_each(subtree.cbegin(), subtree.cend(), [this](TreeVertex* v)
+	{
+		auto iterator = incomingEdges.find(v->originalVertex);
+
+		if (iterator != incomingEdges.cend())
+		{
+			for (const auto& edge : iterator->second)
+			{
+				relaxEdge(getDecoratedVersionOf(*edge.start), *v, edge.weight);
+			}
+		}
+	});
+}
+
+DynamicDijkstraShortestPath::TreeVertex&
+DynamicDijkstraShortestPath::ShortestPathTree::getDecoratedVersionOf(const Graph::Vertex& v)
+{
+	return decoratedVertices.at(&v);
+}
+
+const Graph::Vertex&
+DynamicDijkstraShortestPath::ShortestPathTree::getSource() const noexcept
+{
+	return source;
+}
+
+DynamicDijkstraShortestPath::TreesStore&
+DynamicDijkstraShortestPath::TreesStore::instance()
+{
+	static TreesStore theOnlyInstance;
+
+	return theOnlyInstance;
+}
+
+DynamicDijkstraShortestPath::TreesStore::~TreesStore()
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	std::for_each(observedGraphs.cbegin(),
+		          observedGraphs.cend(),
+		          [this](const auto& pair)
+	{
+		pair.first->removeObserver(*this);
+	});
+}
+
+DynamicDijkstraShortestPath::ObservedGraphPointer
+DynamicDijkstraShortestPath::TreesStore::startObserving(const Graph& g)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	auto iterator = observedGraphs.find(&g);
+
+	if (iterator == observedGraphs.end())
+	{
+		auto observedGraph = std::make_shared<ObservedGraph>();
+		gatherIncomingEdges(g, observedGraph->incomingEdges);
+
+		iterator = observedGraphs.emplace(&g, std::move(observedGraph)).first;
+
+		try
+		{
+			g.addObserver(*this);
+		}
+		catch (std::bad_alloc&)
+		{
+			observedGraphs.erase(iterator);
+			throw;
+		}
+	}
+
+	return iterator->second;
+}
+
+DynamicDijkstraShortestPath::ObservedGraphPointer
+DynamicDijkstraShortestPath::TreesStore::find(const Graph& g)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	auto iterator = observedGraphs.find(&g);
+
+	return (iterator != observedGraphs.end()) ?
+		   iterator->second :
+		   nullptr;
+}
+
+void DynamicDijkstraShortestPath::TreesStore::onVertexAdded(const Graph& g,
+															const Graph::Vertex& v)
+{
+	updateTreesOf(g, [&v](ObservedGraph& observedGraph)
+	{
+		for (auto& tree : observedGraph.trees)
+		{
+			tree->addVertex(v);
+		}
+	});
+}
+
+void DynamicDijkstraShortestPath::TreesStore::onVertexRemoved(const Graph& g,
+															  const Graph::Vertex& v)
+{
+	updateTreesOf(g, [&v](ObservedGraph& observedGraph)
+	{
+		auto& trees = observedGraph.trees;
+		observedGraph.incomingEdges.erase(&v);
+
+		trees.erase(std::remove_if(trees.begin(),
+			                       trees.end(),
+			                       [&v](const auto& tree)
+		{
+			return tree->getSource() == v;
+		}), trees.end());
+
+		for (auto& tree : trees)
+		{
+			tree->removeVertex(v);
+		}
+	});
+}
+
+void DynamicDijkstraShortestPath::TreesStore::onOutgoingEdgeAdded(const Graph& g,
+																  const Graph::Vertex& start,
+																  const Graph::Vertex& end,
+																  Graph::OutgoingEdge::Weight weight)
+{
+	updateTreesOf(g, [&](ObservedGraph& observedGraph)
+	{
+		observedGraph.incomingEdges[&end].push_back({ &start, weight });
+
+		for (auto& tree : observedGraph.trees)
+		{
+			tree->repairAfterAddingEdge(start, end, weight);
+		}
+	});
+}
+
+void DynamicDijkstraShortestPath::TreesStore::onOutgoingEdgeRemoved(const Graph& g,
+																	const Graph::Vertex& start,
+																	const Graph::Vertex& end,
+																	Graph::OutgoingEdge::Weight)
+{
+	updateTreesOf(g, [&](ObservedGraph& observedGraph)
+	{
+		removeIncomingEdge(observedGraph.incomingEdges, start, end);
+
+		for (auto& tree : observedGraph.trees)
+		{
+			tree->repairAfterRemovingEdge(start, end);
+		}
+	});
+}
+
+void DynamicDijkstraShortestPath::TreesStore::onGraphDestroyed(const Graph& g)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	observedGraphs.erase(&g);
+}
+
+void DynamicDijkstraShortestPath::TreesStore::stopObserving(const Graph& g)
+{
+	auto lock = std::lock_guard<std::mutex>(mutex);
+
+	g.removeObserver(*this);
+	observedGraphs.erase(&g);
+}
+
+DynamicDijkstraShortestPath::DynamicDijkstraShortestPath(String id) :
+	ShortestPathAlgorithm(std::move(id)),
+	currentTree(nullptr)
+{
+}
+
+ShortestPathAlgorithm::Cost
+DynamicDijkstraShortestPath::estimateCostOfSearchFrom(const Graph::Vertex& source,
+													  const Graph& g) const
+{
+	return hasTreeRootedAt(source, g) ?
+		   Cost(g.getVerticesCount()) :
+		   estimateCostOfPriorityFirstTraversalOf(g) + estimateCostOfTraversalOf(g);
+}
+
+bool DynamicDijkstraShortestPath::hasTreeRootedAt(const Graph::Vertex& source,
+												  const Graph& g)
+{
+	ObservedGraphPointer observedGraph = TreesStore::instance().find(g);
+
+	if (observedGraph == nullptr)
+	{
+		return false;
+	}
+
+	auto lock = std::lock_guard<std::mutex>(observedGraph->treesMutex);
+
+	return std::any_of(observedGraph->trees.cbegin(),
+		               observedGraph->trees.cend(),
+		               [&source](const auto& tree)
+	{
+		return tree->getSource() == source;
+	});
+}
+
+/*
+	The trees of the graph stay locked until the search is cleaned up, so
+	that another search cannot replace the tree while it is being used.
+*/
+void DynamicDijkstraShortestPath::initialise(const Graph& g,
+											 const Graph::Vertex& source,
+											 const Graph::Vertex& target)
+{
+	observedGraph = TreesStore::instance().startObserving(g);
+	treesLock = std::unique_lock<std::mutex>(observedGraph->treesMutex);
+	currentTree = &getTreeRootedAt(source, g, *observedGraph);
+}
+
+DynamicDijkstraShortestPath::ShortestPathTree&
+DynamicDijkstraShortestPath::getTreeRootedAt(const Graph::Vertex& source,
+											 const Graph& g,
+											 ObservedGraph& observedGraph)
+{
+	auto& trees = observedGraph.trees;
+	auto iterator = std::find_if(trees.cbegin(),
+		                         trees.cend(),
+		                         [&source](const auto& tree)
+	{
+		return tree->getSource() == source;
+	});
+
+	return (iterator != trees.cend()) ?
+		   **iterator :
+		   addTreeRootedAt(source, g, observedGraph);
+}
+
+void DynamicDijkstraShortestPath::gatherIncomingEdges(const Graph& g,
+													  IncomingEdges& edges)
+{
+	auto verticesIterator = g.getConstIteratorOfVertices();
+
+	forEach(*verticesIterator, [&g, &edges](const auto& vertex)
+	{
+		auto edgesIterator = g.getConstIteratorOfEdgesLeaving(vertex);
+
+		forEach(*edgesIterator, [&vertex, &edges](const auto& edge)
+		{
+			edges[&edge.getEnd()].push_back({ &vertex, edge.getWeight() });
+		});
+	});
+}
+
+DynamicDijkstraShortestPath::ShortestPathTree&
+DynamicDijkstraShortestPath::addTreeRootedAt(const Graph::Vertex& source,
+											 const Graph& g,
+											 ObservedGraph& observedGraph)
+{
+	auto& trees = observedGraph.trees;
+	auto tree =
+		std::make_unique<ShortestPathTree>(g,
+			                               source,
+			                               observedGraph.incomingEdges,
+			                               getStatistics(),
+			                               getBudget());
+
+	if (trees.size() == MAX_TREES_PER_GRAPH)
+	{
+		trees.erase(trees.begin());
+	}
+
+	trees.push_back(std::move(tree));
+
+	return *trees.back();
+}
+
+void DynamicDijkstraShortestPath::execute(const Graph&,
+										  const Graph::Vertex&,
+										  const Graph::Vertex&)
+{
+}
+
+void DynamicDijkstraShortestPath::cleanUp()
+{
+	currentTree = nullptr;
+
+	if (treesLock.owns_lock())
+	{
+		treesLock.unlock();
+	}
+
+	observedGraph = nullptr;
+}
+
+void DynamicDijkstraShortestPath::addDecoratedVersionOf(const Graph::Vertex& v)
+{
+	assert(currentTree != nullptr);
+
+	currentTree->addVertex(v);
+}
+
+DynamicDijkstraShortestPath::TreeVertex&
+DynamicDijkstraShortestPath::getDecoratedVersionOf(const Graph::Vertex& v)
+{
+	assert(currentTree != nullptr);
+
+	return currentTree->getDecoratedVersionOf(v);
+}
+
+void DynamicDijkstraShortestPath::removeIncomingEdge(IncomingEdges& edges,
+													 const Graph::Vertex& start,
+													 const Graph::Vertex& end)
+{
+	auto iterator = edges.find(&end);
+
+	if (iterator != edges.end())
+	{
+		auto& edgesToEnd = iterator->second;
+
+		edgesToEnd.erase(std::remove_if(edgesToEnd.begin(),
+			                            edgesToEnd.end(),
+			                            [&start](const IncomingEdge& e)
+		{
+			return e.start == &start;
+		}), edgesToEnd.end());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#ifndef __DYNAMIC_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
+#define __DYNAMIC_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
+
+#include "../Abstract class/ShortestPathAlgorithm.h"
+#include "Priority Queue/PriorityQueue.h"
+#include "Graph/Abstract class/Graph.h"
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <new>
+
+class DynamicDijkstraShortestPath : public ShortestPathAlgorithm
+{
+	struct TreeVertex : public DecoratedVertex
+	{
+		TreeVertex() = default;
+		explicit TreeVertex(const Graph::Vertex& v) noexcept :
+			DecoratedVertex{ v }
+		{
+		}
+
+		PriorityQueueHandle handle;
+	};
+
+	class KeyAccessor
+	{
+	public:
+		const Distance& getKeyOf(const TreeVertex* v)
+		const noexcept
+		{
+			assert(v != nullptr);
+			return v->distanceToSource;
+		}
+
+		void setKeyOfWith(TreeVertex* v, const Distance& d)
+		const noexcept
+		{
+			assert(v != nullptr);
+			v->distanceToSource = d;
+		}
+	};
+
+	class HandleUpdator
+	{
+	public:
+		void operator()(TreeVertex* v, const PriorityQueueHandle& h)
+		const noexcept
+		{
+			assert(v != nullptr);
+			v->handle = h;
+		}
+	};
+
+	struct IncomingEdge
+	{
+		const Graph::Vertex* start;
+		Graph::OutgoingEdge::Weight weight;
+	};
+
+	using PriorityQueue = PriorityQueue<TreeVertex*,
+		                                Less,
+		                                Distance,
+		                                KeyAccessor,
+		                                HandleUpdator>;
+	using IncomingEdges = std::unordered_map<const Graph::Vertex*,
+		                                     std::vector<IncomingEdge>>;
+
+	/*
+		A tree is built as part of the search that asks for it, so that
+		work is counted in the statistics and the budget of that search.
+		The repairs done later by the threads that change the graph are
+		not part of any search and are counted by the tree itself.
+	*/
+	class ShortestPathTree
+	{
+		using Map = std::unordered_map<const Graph::Vertex*, TreeVertex>;
+
+	public:
+		ShortestPathTree(const Graph& g,
+			             const Graph::Vertex& source,
+			             const IncomingEdges& incomingEdges,
+			             SearchStatistics& statistics,
+			             SearchBudget& budget);
+		ShortestPathTree(const ShortestPathTree&) = delete;
+		ShortestPathTree& operator=(const ShortestPathTree&) = delete;
+
+		void addVertex(const Graph::Vertex& v);
+		void removeVertex(const Graph::Vertex& v);
+		void repairAfterAddingEdge(const Graph::Vertex& start,
+			                       const Graph::Vertex& end,
+			                       Graph::OutgoingEdge::Weight weight);
+		void repairAfterRemovingEdge(const Graph::Vertex& start,
+			                         const Graph::Vertex& end);
+		TreeVertex& getDecoratedVersionOf(const Graph::Vertex& v);
+		const Graph::Vertex& getSource() const noexcept;
+
+	private:
+		void build();
+		void settleVerticesInQueue();
+		void relaxEdgesLeaving(const TreeVertex& v);
+		void relaxEdge(const TreeVertex& start,
+			           TreeVertex& end,
+			           Graph::OutgoingEdge::Weight weight);
+		void lowerEstimateOf(TreeVertex& v, const Distance& d);
+		std::vector<TreeVertex*> collectSubtreeRootedAt(TreeVertex& root);
+		void detach(const std::vector<TreeVertex*>& subtree) noexcept;
+		void estimateThroughIncomingEdges(const std::vector<TreeVertex*>& subtree);
+
+	private:
+		const Graph& graph;
+		const Graph::Vertex& source;
+		const IncomingEdges& incomingEdges;
+		SearchStatistics* statistics;
+		SearchBudget* budget;
+		SearchStatistics statisticsOfRepairs;
+		SearchBudget budgetOfRepairs;
+		Map decoratedVertices;
+		PriorityQueue undeterminedEstimateVertices;
+	};
+
+	using Trees = std::vector<std::unique_ptr<ShortestPathTree>>;
+
+	struct ObservedGraph
+	{
+		IncomingEdges incomingEdges;
+		Trees trees;
+		std::mutex treesMutex;
+	};
+
+	using ObservedGraphPointer = std::shared_ptr<ObservedGraph>;
+	using ObservedGraphs =
+		std::unordered_map<const Graph*, ObservedGraphPointer>;
+
+	/*
+		The trees of a graph are shared by the instances of all threads.
+		They are repaired while the graph is being changed, that is while
+		it is locked for writing and no search uses them. Searches only
+		lock the graph for reading, so the trees of each graph also have
+		a mutex which a search holds while it uses or adds trees.
+	*/
+	class TreesStore : private Graph::Observer
+	{
+	public:
+		static TreesStore& instance();
+
+	public:
+		TreesStore(const TreesStore&) = delete;
+		TreesStore& operator=(const TreesStore&) = delete;
+
+		ObservedGraphPointer startObserving(const Graph& g);
+		ObservedGraphPointer find(const Graph& g);
+
+	private:
+		TreesStore() = default;
+		~TreesStore();
+
+		void onVertexAdded(const Graph& g, const Graph::Vertex& v) override;
+		void onVertexRemoved(const Graph& g, const Graph::Vertex& v) override;
+		void onOutgoingEdgeAdded(const Graph& g,
+			                     const Graph::Vertex& start,
+			                     const Graph::Vertex& end,
+			                     Graph::OutgoingEdge::Weight weight) override;
+		void onOutgoingEdgeRemoved(const Graph& g,
+			                       const Graph::Vertex& start,
+			                       const Graph::Vertex& end,
+			                       Graph::OutgoingEdge::Weight weight) override;
+		void onGraphDestroyed(const Graph& g) override;
+
+		void stopObserving(const Graph& g);
+		template <class Function>
+		void updateTreesOf(const Graph& g, Function f);
+
+	private:
+		ObservedGraphs observedGraphs;
+		std::mutex mutex;
+	};
+
+public:
+	explicit DynamicDijkstraShortestPath(String id);
+	DynamicDijkstraShortestPath(const DynamicDijkstraShortestPath&) = delete;
+	DynamicDijkstraShortestPath& operator=(const DynamicDijkstraShortestPath&) = delete;
+
+	Cost estimateCostOfSearchFrom(const Graph::Vertex& source,
+		                          const Graph& g) const override;
+
+private:
+	static void gatherIncomingEdges(const Graph& g, IncomingEdges& edges);
+	static void removeIncomingEdge(IncomingEdges& edges,
+		                           const Graph::Vertex& start,
+		                           const Graph::Vertex& end);
+	static bool hasTreeRootedAt(const Graph::Vertex& source,
+		                        const Graph& g);
+
+private:
+	void initialise(const Graph& g,
+		            const Graph::Vertex& source,
+		            const Graph::Vertex& target) override;
+	void execute(const Graph& g,
+		         const Graph::Vertex& source,
+		         const Graph::Vertex& target) override;
+	void cleanUp() override;
+	void addDecoratedVersionOf(const Graph::Vertex& v) override;
+	TreeVertex& getDecoratedVersionOf(const Graph::Vertex& v) override;
+
+	ShortestPathTree& getTreeRootedAt(const Graph::Vertex& source,
+		                              const Graph& g,
+		                              ObservedGraph& observedGraph);
+	ShortestPathTree& addTreeRootedAt(const Graph::Vertex& source,
+		                              const Graph& g,
+		                              ObservedGraph& observedGraph);
+
+private:
+	static const std::size_t MAX_TREES_PER_GRAPH = 4;
+
+private:
+	ObservedGraphPointer observedGraph;
+	std::unique_lock<std::mutex> treesLock;
+	ShortestPathTree* currentTree;
+};
+
+/*
+	The trees are repaired without holding the lock of the store, so that
+	searches in other graphs are not blocked by the repairs. The trees are
+	shared, so they outlive the repair even if the graph stops being
+	observed meanwhile.
+*/
+template <class Function>
+void DynamicDijkstraShortestPath::TreesStore::updateTreesOf(const Graph& g, Function f)
+{
+	ObservedGraphPointer observedGraph = find(g);
+
+	if (observedGraph != nullptr)
+	{
+		try
+		{
+			auto lock = std::lock_guard<std::mutex>(observedGraph->treesMutex);
+
+			f(*observedGraph);
+		}
+		catch (std::bad_alloc&)
+		{
+			stopObserving(g);
+		}
+	}
+}
+
+#endif //__DYNAMIC_DIJKSTRA_SHORTEST_PATH_HEADER_INCLUDED__
\ No newline at end of file
@@ -9,6 +9,15 @@ IterativeDeepeningDFS::IterativeDeepeningDFS(String id) :
 {
 }
 
+ShortestPathAlgorithm::Cost
+IterativeDeepeningDFS::estimateCostOfSearchFrom(const Graph::Vertex&,
+												const Graph& g) const
+{
+	return g.hasOnlyUnitWeights() ?
+		   g.getVerticesCount() * estimateCostOfTraversalOf(g) :
+		   getInfiniteCost();
+}
+
 void IterativeDeepeningDFS::initialise(const Graph& g,
 									   const Graph::Vertex& source,
 									   const Graph::Vertex& target)
@@ -28,6 +37,7 @@ void IterativeDeepeningDFS::execute(const Graph& g,
 
 	while (!foundAShortestPath && depth <= maxLengthOfShortestPath)
 	{
+		getStatistics().countIteration();
 		depthLimitedSearch(getDecoratedVersionOf(source), depth);
 		++depth;
 	}
@@ -37,6 +47,8 @@ void IterativeDeepeningDFS::depthLimitedSearch(MarkableDecoratedVertex& v,
 											   unsigned depth)
 {
 	v.isVisited = true;
+	getStatistics().countSettledVertex();
+	getBudget().spend();
 
 	if (depth == 0)
 	{
@@ -64,6 +76,7 @@ void IterativeDeepeningDFS::expandSearch(const MarkableDecoratedVertex& v,
 	{
 		auto& successor =
 			getDecoratedVersionOf(edge.getEnd());
+		getStatistics().countScannedEdge();
 
 		if (!successor.isVisited)
 		{
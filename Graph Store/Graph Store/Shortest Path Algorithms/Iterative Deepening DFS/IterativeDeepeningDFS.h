@@ -10,6 +10,9 @@ public:
 	IterativeDeepeningDFS(const IterativeDeepeningDFS&) = delete;
 	IterativeDeepeningDFS& operator=(const IterativeDeepeningDFS&) = delete;
 
+	Cost estimateCostOfSearchFrom(const Graph::Vertex& source,
+		                          const Graph& g) const override;
+
 private:
 	void initialise(const Graph& g,
 		            const Graph::Vertex& source,
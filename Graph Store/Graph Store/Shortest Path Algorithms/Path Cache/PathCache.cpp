@@ -0,0 +1,125 @@
+#include "PathCache.h"
+#include <stdexcept>
+#include <assert.h>
+
+std::size_t PathCache::QueryHashFunction::operator()(const Query& q) const noexcept
+{
+	auto hashFunction = HashFunction<String>{};
+	std::size_t hashValue = hashFunction(q.graphID);
+
+	combine(hashValue, std::hash<Graph::Version>{}(q.graphVersion));
+	combine(hashValue, hashFunction(q.sourceID));
+	combine(hashValue, hashFunction(q.targetID));
+	combine(hashValue, hashFunction(q.algorithmID));
+
+	return hashValue;
+}
+
+void PathCache::QueryHashFunction::combine(std::size_t& hashValue,
+										   std::size_t value) noexcept
+{
+	hashValue ^= value + 0x9e3779b9 + (hashValue << 6) + (hashValue >> 2);
+}
+
+bool PathCache::QueryEquality::operator()(const Query& lhs,
+										  const Query& rhs) const
+{
+	return lhs.graphVersion == rhs.graphVersion
+		   && lhs.graphID == rhs.graphID
+		   && lhs.sourceID == rhs.sourceID
+		   && lhs.targetID == rhs.targetID
+		   && lhs.algorithmID == rhs.algorithmID;
+}
+
+PathCache::PathCache(std::size_t maxEntriesCount) :
+	maxEntriesCount(maxEntriesCount),
+	hitsCount(0),
+	missesCount(0)
+{
+	if (maxEntriesCount == 0)
+	{
+		throw std::invalid_argument("The cache must be able to hold at least one entry!");
+	}
+}
+
+const PathCache::Path* PathCache::search(const Query& q)
+{
+	auto iterator = entriesSearchSet.find(q);
+
+	if (iterator != entriesSearchSet.end())
+	{
+		++hitsCount;
+		markAsMostRecentlyUsed(iterator->second);
+
+		return &(iterator->second->path);
+	}
+	else
+	{
+		++missesCount;
+
+		return nullptr;
+	}
+}
+
+void PathCache::markAsMostRecentlyUsed(Entries::iterator entry) noexcept
+{
+	entries.splice(entries.begin(), entries, entry);
+}
+
+const PathCache::Path& PathCache::add(Query q, Path p)
+{
+	auto iterator = entriesSearchSet.find(q);
+
+	if (iterator != entriesSearchSet.end())
+	{
+		return iterator->second->path;
+	}
+
+	if (entries.size() == maxEntriesCount)
+	{
+		removeLeastRecentlyUsedEntry();
+	}
+
+	entries.push_front(Entry{ std::move(q), std::move(p) });
+
+	try
+	{
+		entriesSearchSet.emplace(entries.front().query, entries.begin());
+	}
+	catch (std::bad_alloc&)
+	{
+		entries.pop_front();
+		throw;
+	}
+
+	return entries.front().path;
+}
+
+void PathCache::removeLeastRecentlyUsedEntry()
+{
+	assert(!entries.empty());
+
+	entriesSearchSet.erase(entries.back().query);
+	entries.pop_back();
+}
+
+void PathCache::empty() noexcept
+{
+	entriesSearchSet.clear();
+	entries.clear();
+}
+
+std::size_t PathCache::getEntriesCount() const noexcept
+{
+	return entries.size();
+}
+
+std::size_t PathCache::getHitsCount() const noexcept
+{
+	return hitsCount;
+}
+
+std::size_t PathCache::getMissesCount() const noexcept
+{
+	return missesCount;
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#ifndef __PATH_CACHE_HEADER_INCLUDED__
+#define __PATH_CACHE_HEADER_INCLUDED__
+
+#include "Shortest Path Algorithms/Abstract class/ShortestPathAlgorithm.h"
+#include "Hash/Hash Function/HashFunction.h"
+#include <unordered_map>
+#include <list>
+#include <algorithm>
+
+class PathCache
+{
+public:
+	struct Query
+	{
+		String graphID;
+		Graph::Version graphVersion;
+		String sourceID;
+		String targetID;
+		String algorithmID;
+	};
+
+	using Path = ShortestPathAlgorithm::Path;
+
+private:
+	struct Entry
+	{
+		Query query;
+		Path path;
+	};
+
+	class QueryHashFunction
+	{
+	public:
+		std::size_t operator()(const Query& q) const noexcept;
+
+	private:
+		static void combine(std::size_t& hashValue, std::size_t value) noexcept;
+	};
+
+	class QueryEquality
+	{
+	public:
+		bool operator()(const Query& lhs, const Query& rhs) const;
+	};
+
+	using Entries = std::list<Entry>;
+	using Map = std::unordered_map<std::reference_wrapper<const Query>,
+		                           Entries::iterator,
+		                           QueryHashFunction,
+		                           QueryEquality>;
+
+public:
+	explicit PathCache(std::size_t maxEntriesCount = DEFAULT_MAX_ENTRIES_COUNT);
+	PathCache(const PathCache&) = delete;
+	PathCache& operator=(const PathCache&) = delete;
+
+	const Path* search(const Query& q);
+	const Path& add(Query q, Path p);
+	void empty() noexcept;
+	template <class Function>
+	void forEachEntryOf(const String& graphID,
+		                Graph::Version graphVersion,
+		                Function f) const;
+
+	std::size_t getEntriesCount() const noexcept;
+	std::size_t getHitsCount() const noexcept;
+	std::size_t getMissesCount() const noexcept;
+
+private:
+	static const std::size_t DEFAULT_MAX_ENTRIES_COUNT = 256;
+
+private:
+	void markAsMostRecentlyUsed(Entries::iterator entry) noexcept;
+	void removeLeastRecentlyUsedEntry();
+
+private:
+	std::size_t maxEntriesCount;
+	std::size_t hitsCount;
+	std::size_t missesCount;
+	Entries entries;
+	Map entriesSearchSet;
+};
+
+/*
+	Calls f with the query and the path of each entry for the specified
+	version of the graph, from the least to the most recently used one.
+*/
+template <class Function>
+void PathCache::forEachEntryOf(const String& graphID,
+	                           Graph::Version graphVersion,
+	                           Function f) const
+{
+	std::for_each(entries.crbegin(), entries.crend(), [&](const Entry& entry)
+	{
+		if (entry.query.graphVersion == graphVersion
+			&& entry.query.graphID == graphID)
+		{
+			f(entry.query, entry.path);
+		}
+	});
+}
+
+#endif //__PATH_CACHE_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "SearchBudget.h"
+#include "SearchBudgetException.h"
+#include <string>
+
+SearchBudget::SearchBudget() noexcept :
+	timeLimit(Duration::zero()),
+	workLimit(0),
+	cancellationFlag(nullptr),
+	settledVerticesCount(0)
+{
+}
+
+void SearchBudget::setTimeLimit(const Duration& limit) noexcept
+{
+	timeLimit = limit;
+}
+
+void SearchBudget::setWorkLimit(std::size_t maxSettledVerticesCount) noexcept
+{
+	workLimit = maxSettledVerticesCount;
+}
+
+void SearchBudget::setCancellationFlag(const std::atomic<bool>& flag) noexcept
+{
+	cancellationFlag = &flag;
+}
+
+void SearchBudget::start() noexcept
+{
+	settledVerticesCount = 0;
+
+	if (hasTimeLimit())
+	{
+		deadline = Clock::now() + timeLimit;
+	}
+}
+
+void SearchBudget::spend()
+{
+	++settledVerticesCount;
+
+	verifyWorkLimitIsNotExceeded();
+
+	if (settledVerticesCount % CLOCK_CHECK_PERIOD == 0)
+	{
+		verifyIsNotCancelled();
+		verifyTimeLimitIsNotExceeded();
+	}
+}
+
+void SearchBudget::verifyIsNotCancelled() const
+{
+	if (cancellationFlag != nullptr && cancellationFlag->load())
+	{
+		throw SearchBudgetException("The search was interrupted after settling "
+			                        + std::to_string(settledVerticesCount)
+			                        + " vertices!");
+	}
+}
+
+void SearchBudget::verifyWorkLimitIsNotExceeded() const
+{
+	if (hasWorkLimit() && settledVerticesCount > workLimit)
+	{
+		throw SearchBudgetException("The search was stopped: it exceeded the limit of "
+			                        + std::to_string(workLimit)
+			                        + " settled vertices!");
+	}
+}
+
+void SearchBudget::verifyTimeLimitIsNotExceeded() const
+{
+	if (hasTimeLimit() && Clock::now() > deadline)
+	{
+		throw SearchBudgetException("The search was stopped: it exceeded the time limit of "
+			                        + std::to_string(timeLimit.count())
+			                        + " ms after settling "
+			                        + std::to_string(settledVerticesCount)
+			                        + " vertices!");
+	}
+}
+
+bool SearchBudget::hasTimeLimit() const noexcept
+{
+	return timeLimit != Duration::zero();
+}
+
+bool SearchBudget::hasWorkLimit() const noexcept
+{
+	return workLimit != 0;
+}
\ No newline at end of file
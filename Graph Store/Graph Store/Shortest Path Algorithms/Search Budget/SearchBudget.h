@@ -0,0 +1,41 @@
+#ifndef __SEARCH_BUDGET_HEADER_INCLUDED__
+#define __SEARCH_BUDGET_HEADER_INCLUDED__
+
+#include <chrono>
+#include <atomic>
+
+class SearchBudget
+{
+public:
+	using Clock = std::chrono::steady_clock;
+	using Duration = std::chrono::milliseconds;
+
+public:
+	SearchBudget() noexcept;
+
+	void setTimeLimit(const Duration& limit) noexcept;
+	void setWorkLimit(std::size_t maxSettledVerticesCount) noexcept;
+	void setCancellationFlag(const std::atomic<bool>& flag) noexcept;
+
+	void start() noexcept;
+	void spend();
+
+private:
+	static const std::size_t CLOCK_CHECK_PERIOD = 256;
+
+private:
+	void verifyIsNotCancelled() const;
+	void verifyWorkLimitIsNotExceeded() const;
+	void verifyTimeLimitIsNotExceeded() const;
+	bool hasTimeLimit() const noexcept;
+	bool hasWorkLimit() const noexcept;
+
+private:
+	Duration timeLimit;
+	std::size_t workLimit;
+	const std::atomic<bool>* cancellationFlag;
+	Clock::time_point deadline;
+	std::size_t settledVerticesCount;
+};
+
+#endif //__SEARCH_BUDGET_HEADER_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef __SEARCH_BUDGET_EXCEPTION_HEADER_INCLUDED__
+#define __SEARCH_BUDGET_EXCEPTION_HEADER_INCLUDED__
+
+#include "Runtime Error/RuntimeError.h"
+
+class SearchBudgetException : public RuntimeError
+{
+public:
+	explicit SearchBudgetException(String errorMessage) :
+		RuntimeError(std::move(errorMessage))
+	{
+	}
+
+	explicit SearchBudgetException(const std::string& errorMessage) :
+		RuntimeError(errorMessage)
+	{
+	}
+};
+
+#endif //__SEARCH_BUDGET_EXCEPTION_HEADER_INCLUDED__
\ No newline at end of file
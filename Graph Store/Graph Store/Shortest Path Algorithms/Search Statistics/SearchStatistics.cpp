@@ -0,0 +1,34 @@
+#include "SearchStatistics.h"
+
+static void printDuration(std::ostream& out,
+						  const char* phase,
+						  const SearchStatistics::Duration& d)
+{
+	auto microseconds =
+		std::chrono::duration_cast<std::chrono::microseconds>(d);
+
+	out << phase << ": " << microseconds.count() << " us\n";
+}
+
+std::ostream& operator<<(std::ostream& out, const SearchStatistics& s)
+{
+	if (!SearchStatistics::IS_ENABLED)
+	{
+		return out << "Search statistics are not collected in this build.\n";
+	}
+
+	out << "Decorated vertices: " << s.decoratedVerticesCount << '\n'
+		<< "Settled vertices: " << s.settledVerticesCount << '\n'
+		<< "Scanned edges: " << s.scannedEdgesCount << '\n'
+		<< "Queue pushes: " << s.queuePushesCount << '\n'
+		<< "Key decreases: " << s.keyDecreasesCount << '\n'
+		<< "Queue pops: " << s.queuePopsCount << '\n'
+		<< "Iterations: " << s.iterationsCount << '\n';
+
+	printDuration(out, "Initialisation", s.initialisationTime);
+	printDuration(out, "Execution", s.executionTime);
+	printDuration(out, "Path creation", s.pathCreationTime);
+	printDuration(out, "Clean up", s.cleanUpTime);
+
+	return out;
+}
\ No newline at end of file
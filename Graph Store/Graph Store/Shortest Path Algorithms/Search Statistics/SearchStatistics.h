@@ -0,0 +1,80 @@
+#ifndef __SEARCH_STATISTICS_HEADER_INCLUDED__
+#define __SEARCH_STATISTICS_HEADER_INCLUDED__
+
+#include <chrono>
+#include <ostream>
+
+struct SearchStatistics
+{
+	using Clock = std::chrono::steady_clock;
+	using Duration = Clock::duration;
+
+	class PhaseTimer
+	{
+	public:
+		explicit PhaseTimer(Duration& phaseDuration) noexcept :
+			phaseDuration(phaseDuration),
+			start(IS_ENABLED ? Clock::now() : Clock::time_point{})
+		{
+		}
+
+		PhaseTimer(const PhaseTimer&) = delete;
+		PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+		~PhaseTimer()
+		{
+			if (IS_ENABLED)
+			{
+				phaseDuration = Clock::now() - start;
+			}
+		}
+
+	private:
+		Duration& phaseDuration;
+		Clock::time_point start;
+	};
+
+#ifdef GRAPH_STORE_NO_SEARCH_STATISTICS
+	static const bool IS_ENABLED = false;
+#else
+	static const bool IS_ENABLED = true;
+#endif
+
+	void reset() noexcept
+	{
+		*this = SearchStatistics{};
+	}
+
+	void countDecoratedVertex() noexcept { increment(decoratedVerticesCount); }
+	void countSettledVertex() noexcept { increment(settledVerticesCount); }
+	void countScannedEdge() noexcept { increment(scannedEdgesCount); }
+	void countQueuePush() noexcept { increment(queuePushesCount); }
+	void countQueuePushes(std::size_t count) noexcept { increment(queuePushesCount, count); }
+	void countKeyDecrease() noexcept { increment(keyDecreasesCount); }
+	void countQueuePop() noexcept { increment(queuePopsCount); }
+	void countIteration() noexcept { increment(iterationsCount); }
+
+	static void increment(std::size_t& counter, std::size_t amount = 1) noexcept
+	{
+		if (IS_ENABLED)
+		{
+			counter += amount;
+		}
+	}
+
+	std::size_t decoratedVerticesCount = 0;
+	std::size_t settledVerticesCount = 0;
+	std::size_t scannedEdgesCount = 0;
+	std::size_t queuePushesCount = 0;
+	std::size_t keyDecreasesCount = 0;
+	std::size_t queuePopsCount = 0;
+	std::size_t iterationsCount = 0;
+	Duration initialisationTime = Duration::zero();
+	Duration executionTime = Duration::zero();
+	Duration pathCreationTime = Duration::zero();
+	Duration cleanUpTime = Duration::zero();
+};
+
+std::ostream& operator<<(std::ostream& out, const SearchStatistics& s);
+
+#endif //__SEARCH_STATISTICS_HEADER_INCLUDED__
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "String/String.h"
 #include "Shortest Path Algorithms/Abstract class/ShortestPathAlgorithm.h"
 #include "Iterator/Iterator.h"
+#include <algorithm>
+#include <cstring>
 #include <assert.h>
 
 ShortestPathAlgorithmsStore::IDComparator::IDComparator(const String& id) noexcept :
@@ -21,14 +23,54 @@ ShortestPathAlgorithmsStore::IDComparator::operator()(const ShortestPathAlgorith
 ShortestPathAlgorithmsStore::ShortestPathAlgorithmsStore() :
 	algorithms(INITIAL_COLLECTION_SIZE)
 {
+	for (const RegisteredAlgorithm& a : getRegisteredAlgorithms())
+	{
+		addAlgorithm(a.create());
+	}
+}
+
+ShortestPathAlgorithmsStore::~ShortestPathAlgorithmsStore()
+{
+	auto iterator = algorithms.getIterator();
+
+	forEach(iterator, [](ShortestPathAlgorithm* a)
+	{
+		delete a;
+	});
 }
 
 ShortestPathAlgorithmsStore&
 ShortestPathAlgorithmsStore::instance()
 {
-	static ShortestPathAlgorithmsStore theOnlyInstance;
+	thread_local ShortestPathAlgorithmsStore theInstanceOfThisThread;
 	
-	return theOnlyInstance;
+	return theInstanceOfThisThread;
+}
+
+void ShortestPathAlgorithmsStore::registerAlgorithm(const char* id,
+													Factory create)
+{
+	RegisteredAlgorithms& registeredAlgorithms = getRegisteredAlgorithms();
+
+	if (std::any_of(registeredAlgorithms.cbegin(),
+		            registeredAlgorithms.cend(),
+		            [id](const RegisteredAlgorithm& a)
+	{
+		return std::strcmp(a.id, id) == 0;
+	}))
+	{
+		throw std::logic_error{ "Duplicate algorithm!" };
+	}
+
+	registeredAlgorithms.push_back({ id, std::move(create) });
+}
+
+ShortestPathAlgorithmsStore::RegisteredAlgorithms&
+ShortestPathAlgorithmsStore::getRegisteredAlgorithms()
+{
+	static RegisteredAlgorithms registeredAlgorithms;
+
+	return registeredAlgorithms;
 }
 
 ShortestPathAlgorithm&
@@ -47,20 +89,53 @@ ShortestPathAlgorithmsStore::operator[](const String& id)
 	}
 }
 
-void ShortestPathAlgorithmsStore::addAlgorithm(ShortestPathAlgorithm& a)
+void ShortestPathAlgorithmsStore::addAlgorithm(AlgorithmPointer a)
 {
-	if (!contains(a.getID()))
+	assert(a != nullptr && !contains(a->getID()));
+
+	algorithms.add(a.get());
+	a.release();
+}
+
+bool ShortestPathAlgorithmsStore::contains(const String& id) const
+{
+	return anyOf(algorithms.getConstIterator(),
+		         IDComparator{ id });
+}
+
+ShortestPathAlgorithm&
+ShortestPathAlgorithmsStore::getCheapestForSearchFrom(const Graph::Vertex& source,
+													  const Graph& g)
+{
+	ShortestPathAlgorithm* cheapest = nullptr;
+	auto minCost = ShortestPathAlgorithm::getInfiniteCost();
+	auto iterator = algorithms.getIterator();
+
+	forEach(iterator, [&](ShortestPathAlgorithm* a)
+	{
+		assert(a != nullptr);
+
+		auto cost = a->estimateCostOfSearchFrom(source, g);
+
+		if (cheapest == nullptr || cost < minCost)
+		{
+			cheapest = a;
+			minCost = cost;
+		}
+	});
+
+	if (cheapest != nullptr)
 	{
-		algorithms.add(&a);
+		return *cheapest;
 	}
 	else
 	{
-		throw std::logic_error{ "Duplicate algorithm!" };
+		throw RuntimeError{ "There are no supported algorithms!"_s };
 	}
 }
 
-bool ShortestPathAlgorithmsStore::contains(const String& id) const
+ShortestPathAlgorithmsStore::Iterator
+ShortestPathAlgorithmsStore::getIterator() noexcept
 {
-	return anyOf(algorithms.getConstIterator(),
-		         IDComparator{ id });
-}
+	return algorithms.getIterator();
+}
\ No newline at end of file
@@ -2,13 +2,31 @@
 #define __SHORTEST_PATH_ALGORITHMS_STORE_HEADER_INCLUDED__
 
 #include "Dynamic Array/DynamicArray.h"
+#include "Graph/Abstract class/Graph.h"
+#include <functional>
+#include <memory>
+#include <vector>
 
 class String;
 class ShortestPathAlgorithm;
 
+/*
+	The algorithms keep the state of the search they do, so each thread
+	has its own store with its own instance of each registered algorithm.
+*/
 class ShortestPathAlgorithmsStore
 {
 	using Collection = DynamicArray<ShortestPathAlgorithm*>;
+	using AlgorithmPointer = std::unique_ptr<ShortestPathAlgorithm>;
+	using Factory = std::function<AlgorithmPointer()>;
+
+	struct RegisteredAlgorithm
+	{
+		const char* id;
+		Factory create;
+	};
+
+	using RegisteredAlgorithms = std::vector<RegisteredAlgorithm>;
 
 	class IDComparator
 	{
@@ -20,20 +38,31 @@ class ShortestPathAlgorithmsStore
 		const String& id;
 	};
 
+public:
+	using Iterator = Collection::Iterator;
+
 public:
 	static ShortestPathAlgorithmsStore& instance();
+	static void registerAlgorithm(const char* id, Factory create);
 
 public:
 	ShortestPathAlgorithmsStore(const ShortestPathAlgorithmsStore&) = delete;
 	ShortestPathAlgorithmsStore&
 		operator=(const ShortestPathAlgorithmsStore&) = delete;
 	ShortestPathAlgorithm& operator[](const String& id);
-	void addAlgorithm(ShortestPathAlgorithm& a);
 	bool contains(const String& id) const;
+	ShortestPathAlgorithm& getCheapestForSearchFrom(const Graph::Vertex& source,
+		                                            const Graph& g);
+	Iterator getIterator() noexcept;
+
+private:
+	static RegisteredAlgorithms& getRegisteredAlgorithms();
 
 private:
 	ShortestPathAlgorithmsStore();
-	~ShortestPathAlgorithmsStore() = default;
+	~ShortestPathAlgorithmsStore();
+
+	void addAlgorithm(AlgorithmPointer a);
 
 private:
 	static const std::size_t INITIAL_COLLECTION_SIZE = 4u;
@@ -0,0 +1,228 @@
+#include "Socket.h"
+#include "String/String.h"
+#include "Runtime Error/RuntimeError.h"
+#include <cstring>
+#include <filesystem>
+#include <utility>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <afunix.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+const Socket::Handle Socket::INVALID_HANDLE = INVALID_SOCKET;
+#else
+const Socket::Handle Socket::INVALID_HANDLE = -1;
+#endif
+
+namespace
+{
+#ifdef MSG_NOSIGNAL
+	const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+	const int SEND_FLAGS = 0;
+#endif
+
+#ifdef _WIN32
+	using Size = int;
+	using AddressSize = int;
+#else
+	using Size = std::size_t;
+	using AddressSize = socklen_t;
+#endif
+
+	void removeStaleSocketFile(const String& socketFileName)
+	{
+		auto error = std::error_code{};
+		auto path = std::filesystem::path(socketFileName.cString());
+
+		if (std::filesystem::is_socket(path, error))
+		{
+			std::filesystem::remove(path, error);
+		}
+	}
+}
+
+Socket::Socket() noexcept :
+	handle(INVALID_HANDLE)
+{
+}
+
+Socket::Socket(Handle handle) noexcept :
+	handle(handle)
+{
+}
+
+Socket::Socket(Socket&& source) noexcept :
+	handle(std::exchange(source.handle, INVALID_HANDLE))
+{
+}
+
+Socket& Socket::operator=(Socket&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		close();
+		handle = std::exchange(rhs.handle, INVALID_HANDLE);
+	}
+
+	return *this;
+}
+
+Socket::~Socket()
+{
+	close();
+}
+
+Socket Socket::listenOn(const String& socketFileName)
+{
+	auto address = sockaddr_un{};
+	address.sun_family = AF_UNIX;
+
+	if (socketFileName.getLength() >= sizeof(address.sun_path))
+	{
+		throw RuntimeError("The socket file name is too long: " + socketFileName);
+	}
+
+	std::strcpy(address.sun_path, socketFileName.cString());
+	removeStaleSocketFile(socketFileName);
+
+	return createListener(AF_UNIX, &address, sizeof(address));
+}
+
+Socket Socket::listenOnPort(std::uint16_t port)
+{
+	auto address = sockaddr_in{};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	return createListener(AF_INET, &address, sizeof(address));
+}
+
+Socket Socket::createListener(int family,
+	                          const void* address,
+	                          std::size_t addressSize)
+{
+	initialiseSockets();
+
+	auto listener = Socket(::socket(family, SOCK_STREAM, 0));
+
+	if (!listener.isOpen()
+		|| ::bind(listener.handle,
+			      static_cast<const sockaddr*>(address),
+			      static_cast<AddressSize>(addressSize)) != 0
+		|| ::listen(listener.handle, CONNECTIONS_BACKLOG) != 0)
+	{
+		throw RuntimeError("Could not listen for connections!"_s);
+	}
+
+	return listener;
+}
+
+void Socket::initialiseSockets()
+{
+#ifdef _WIN32
+	static const bool isInitialised = []()
+	{
+		auto data = WSADATA{};
+		return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+	}();
+
+	if (!isInitialised)
+	{
+		throw RuntimeError("Could not initialise Windows Sockets!"_s);
+	}
+#endif
+}
+
+bool Socket::waitForConnection(std::chrono::milliseconds timeout) const
+{
+	auto descriptors = fd_set{};
+	FD_ZERO(&descriptors);
+	FD_SET(handle, &descriptors);
+
+	auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+	auto time = timeval{};
+	time.tv_sec = static_cast<long>(seconds.count());
+	time.tv_usec = static_cast<long>(
+		std::chrono::duration_cast<std::chrono::microseconds>(timeout - seconds).count());
+
+	return ::select(static_cast<int>(handle) + 1,
+		            &descriptors, nullptr, nullptr, &time) > 0;
+}
+
+Socket Socket::accept() const
+{
+	auto client = Socket(::accept(handle, nullptr, nullptr));
+
+	if (!client.isOpen())
+	{
+		throw RuntimeError("Could not accept a connection!"_s);
+	}
+
+	return client;
+}
+
+std::size_t Socket::receive(char* buffer, std::size_t size) const
+{
+	auto received = ::recv(handle, buffer, static_cast<Size>(size), 0);
+
+	return received > 0 ? static_cast<std::size_t>(received) : 0;
+}
+
+void Socket::send(const char* data, std::size_t size) const
+{
+	while (size > 0)
+	{
+		auto sent = ::send(handle, data, static_cast<Size>(size), SEND_FLAGS);
+
+		if (sent <= 0)
+		{
+			throw RuntimeError("Could not send data to the client!"_s);
+		}
+
+		data += sent;
+		size -= static_cast<std::size_t>(sent);
+	}
+}
+
+void Socket::shutdown() noexcept
+{
+	if (isOpen())
+	{
+#ifdef _WIN32
+		::shutdown(handle, SD_BOTH);
+#else
+		::shutdown(handle, SHUT_RDWR);
+#endif
+	}
+}
+
+void Socket::close() noexcept
+{
+	if (isOpen())
+	{
+#ifdef _WIN32
+		::closesocket(handle);
+#else
+		::close(handle);
+#endif
+		handle = INVALID_HANDLE;
+	}
+}
+
+bool Socket::isOpen() const noexcept
+{
+	return handle != INVALID_HANDLE;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef __SOCKET_HEADER_INCLUDED__
+#define __SOCKET_HEADER_INCLUDED__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+class String;
+
+/*
+	A stream socket that is either listening for local connections, on a
+	Unix domain socket or on a TCP port of the loopback address, or is
+	connected to a client.
+*/
+class Socket
+{
+public:
+#ifdef _WIN32
+	using Handle = std::uintptr_t;
+#else
+	using Handle = int;
+#endif
+
+public:
+	Socket() noexcept;
+	Socket(const Socket&) = delete;
+	Socket& operator=(const Socket&) = delete;
+	Socket(Socket&& source) noexcept;
+	Socket& operator=(Socket&& rhs) noexcept;
+	~Socket();
+
+	static Socket listenOn(const String& socketFileName);
+	static Socket listenOnPort(std::uint16_t port);
+
+	bool waitForConnection(std::chrono::milliseconds timeout) const;
+	Socket accept() const;
+	std::size_t receive(char* buffer, std::size_t size) const;
+	void send(const char* data, std::size_t size) const;
+	void shutdown() noexcept;
+	void close() noexcept;
+	bool isOpen() const noexcept;
+
+private:
+	static void initialiseSockets();
+	static Socket createListener(int family,
+		                         const void* address,
+		                         std::size_t addressSize);
+
+private:
+	explicit Socket(Handle handle) noexcept;
+
+private:
+	static const Handle INVALID_HANDLE;
+	static const int CONNECTIONS_BACKLOG = 64;
+
+private:
+	Handle handle;
+};
+
+#endif //__SOCKET_HEADER_INCLUDED__
\ No newline at end of file
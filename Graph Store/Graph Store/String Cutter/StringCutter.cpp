@@ -4,22 +4,26 @@
 StringCutter::StringCutter(std::initializer_list<char> delimiters) :
 	remainingString(nullptr),
 	word(nullptr),
+	wordEnd(nullptr),
 	delimiters(delimiters)
 {
 }
 
-std::vector<std::string> StringCutter::cutToWords(char* string)
+/*
+	Replaces the delimiters that end words with null characters and
+	stores views of the words, so they point into the cut string.
+*/
+void StringCutter::cutToWords(char* string,
+	                          std::vector<std::string_view>& words)
 {
 	setString(string);
-
-	std::vector<std::string> words;
+	words.clear();
+	skipSpaces();
 
 	while (!hasReachedEnd())
 	{
 		words.push_back(cutWord());
 	}
-
-	return words;
 }
 
 void StringCutter::setString(char* string)
@@ -39,7 +43,7 @@ bool StringCutter::hasReachedEnd() const
 	return *remainingString == '\0';
 }
 
-std::string StringCutter::cutWord()
+std::string_view StringCutter::cutWord()
 {
 	skipSpaces();
 
@@ -48,7 +52,7 @@ std::string StringCutter::cutWord()
 	skipTo(delimiter);
 	markWordEnd();
 
-	std::string word = copySkippedWord();
+	std::string_view word = getSkippedWord();
 	skipSpaces();
 
 	return word;
@@ -120,6 +124,8 @@ void StringCutter::verifyDelimitersMatch(char lhs, char rhs)
 
 void StringCutter::markWordEnd()
 {
+	wordEnd = remainingString;
+
 	if (hasReachedEnd())
 	{
 		return;
@@ -129,7 +135,7 @@ void StringCutter::markWordEnd()
 	++remainingString;
 }
 
-std::string StringCutter::copySkippedWord()
+std::string_view StringCutter::getSkippedWord() const
 {
-	return std::string(word);
+	return std::string_view(word, wordEnd - word);
 }
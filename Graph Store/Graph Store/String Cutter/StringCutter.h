@@ -1,7 +1,7 @@
 #ifndef __STRING_CUTTER_HEADER_INCLUDED__
 #define __STRING_CUTTER_HEADER_INCLUDED__
 
-#include <string>
+#include <string_view>
 #include <vector>
 #include <initializer_list>
 
@@ -11,17 +11,17 @@ public:
 	StringCutter() = default;
 	explicit StringCutter(std::initializer_list<char> delimiters);
 
-	std::vector<std::string> cutToWords(char* string);
+	void cutToWords(char* string, std::vector<std::string_view>& words);
 
 private:
 	static void verifyDelimitersMatch(char lhs, char rhs);
 
 private:
-	std::string cutWord();
+	std::string_view cutWord();
 	void skipSpaces();
 	char skipAndReturnDelimiter();
 	void skipTo(char startDelimiter);
-	std::string copySkippedWord();
+	std::string_view getSkippedWord() const;
 	void markWordEnd();
 	bool hasReachedEnd() const;
 	void setString(char* string);
@@ -34,6 +34,7 @@ private:
 private:
 	char* remainingString;
 	const char* word;
+	const char* wordEnd;
 	std::vector<char> delimiters;
 };
 
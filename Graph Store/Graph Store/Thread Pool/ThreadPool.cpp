@@ -0,0 +1,90 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <stdexcept>
+
+ThreadPool::ThreadPool(std::size_t workersCount) :
+	isStopping(false)
+{
+	workersCount = std::max<std::size_t>(workersCount, 1);
+	workers.reserve(workersCount);
+
+	try
+	{
+		for (auto i = std::size_t{ 0 }; i < workersCount; ++i)
+		{
+			workers.emplace_back([this]() noexcept { work(); });
+		}
+	}
+	catch (...)
+	{
+		stop();
+		throw;
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	stop();
+}
+
+void ThreadPool::enqueue(Task task)
+{
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+
+		if (isStopping)
+		{
+			throw std::logic_error("The thread pool is stopped!");
+		}
+
+		tasks.push(std::move(task));
+	}
+
+	hasTasks.notify_one();
+}
+
+void ThreadPool::work() noexcept
+{
+	while (true)
+	{
+		auto task = Task{};
+
+		{
+			auto lock = std::unique_lock<std::mutex>(mutex);
+			hasTasks.wait(lock, [this]() { return isStopping || !tasks.empty(); });
+
+			if (tasks.empty())
+			{
+				return;
+			}
+
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+
+		task();
+	}
+}
+
+void ThreadPool::stop() noexcept
+{
+	{
+		auto lock = std::lock_guard<std::mutex>(mutex);
+		isStopping = true;
+	}
+
+	hasTasks.notify_all();
+
+	for (auto& worker : workers)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+}
+
+std::size_t ThreadPool::getWorkersCount() const noexcept
+{
+	return workers.size();
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef __THREAD_POOL_HEADER_INCLUDED__
+#define __THREAD_POOL_HEADER_INCLUDED__
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/*
+	Runs submitted tasks on a fixed number of threads, in the order in
+	which they were submitted. Stopping the pool lets the tasks already
+	submitted finish.
+*/
+class ThreadPool
+{
+	using Task = std::function<void()>;
+
+public:
+	explicit ThreadPool(std::size_t workersCount);
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	template <class Function>
+	auto submit(Function f) -> std::future<decltype(f())>;
+
+	void stop() noexcept;
+	std::size_t getWorkersCount() const noexcept;
+
+private:
+	void enqueue(Task task);
+	void work() noexcept;
+
+private:
+	std::mutex mutex;
+	std::condition_variable hasTasks;
+	std::queue<Task> tasks;
+	bool isStopping;
+	std::vector<std::thread> workers;
+};
+
+template <class Function>
+auto ThreadPool::submit(Function f) -> std::future<decltype(f())>
+{
+	using Result = decltype(f());
+
+	auto task = std::make_shared<std::packaged_task<Result()>>(std::move(f));
+	auto result = task->get_future();
+	enqueue([task]() { (*task)(); });
+
+	return result;
+}
+
+#endif //__THREAD_POOL_HEADER_INCLUDED__
\ No newline at end of file
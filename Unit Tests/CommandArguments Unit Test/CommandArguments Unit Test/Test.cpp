@@ -0,0 +1,176 @@
+#include "CppUnitTest.h"
+#include "Command\Command Arguments\CommandArguments.h"
+#include "Command\Exceptions\MissingArgumentException.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace CommandArgumentsUnitTest
+{
+	TEST_CLASS(CommandArgumentsTest)
+	{
+		using Words = CommandArguments::Words;
+
+		static bool areEqual(const String& lhs, const char* rhs)
+		{
+			return strcmp(lhs.cString(), rhs) == 0;
+		}
+
+	public:
+		TEST_METHOD(testTakeOptionValueWithEqualsSign)
+		{
+			Words words = { "--limit=10", "g" };
+			CommandArguments arguments(words);
+
+			auto limit = arguments.takeOptionValue<unsigned>("limit");
+
+			Assert::IsTrue(limit.has_value());
+			Assert::AreEqual(10u, *limit);
+			Assert::IsTrue(areEqual(arguments.takeArgument("graph"), "g"));
+			arguments.verifyAllAreTaken();
+		}
+
+		TEST_METHOD(testTakeOptionValueFromTheNextWord)
+		{
+			Words words = { "g", "--limit", "10" };
+			CommandArguments arguments(words);
+
+			auto limit = arguments.takeOptionValue<unsigned>("limit");
+
+			Assert::IsTrue(limit.has_value());
+			Assert::AreEqual(10u, *limit);
+			Assert::IsTrue(areEqual(arguments.takeArgument("graph"), "g"));
+			arguments.verifyAllAreTaken();
+		}
+
+		TEST_METHOD(testTakeOptionValueOfAMissingOption)
+		{
+			Words words = { "g" };
+			CommandArguments arguments(words);
+
+			auto limit = arguments.takeOptionValue<unsigned>("limit");
+
+			Assert::IsFalse(limit.has_value());
+			Assert::AreEqual(std::size_t(1), words.size());
+		}
+
+		TEST_METHOD(testTakeOptionValueThrowsExceptionIfTheValueIsMissing)
+		{
+			Words words = { "g", "--limit" };
+			CommandArguments arguments(words);
+
+			try
+			{
+				arguments.takeOptionValue<unsigned>("limit");
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (CommandException& e)
+			{
+				Assert::AreEqual("Expected a value for --limit", e.what());
+			}
+		}
+
+		TEST_METHOD(testTakeOptionValueThrowsExceptionIfTheValueIsNotANumber)
+		{
+			Words words = { "--limit=ten" };
+			CommandArguments arguments(words);
+
+			try
+			{
+				arguments.takeOptionValue<unsigned>("limit");
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (CommandException& e)
+			{
+				Assert::AreEqual("Expected a number for [limit], got: ten",
+					             e.what());
+			}
+		}
+
+		TEST_METHOD(testTakeFlag)
+		{
+			Words words = { "a", "--all", "b" };
+			CommandArguments arguments(words);
+
+			Assert::IsTrue(arguments.takeFlag("all"));
+			Assert::IsFalse(arguments.takeFlag("all"));
+			Assert::IsTrue(areEqual(arguments.takeArgument("from"), "a"));
+			Assert::IsTrue(areEqual(arguments.takeArgument("to"), "b"));
+			arguments.verifyAllAreTaken();
+		}
+
+		TEST_METHOD(testTakeArgumentThrowsExceptionForAnUnknownOption)
+		{
+			Words words = { "--unknown", "g" };
+			CommandArguments arguments(words);
+
+			try
+			{
+				arguments.takeArgument("graph");
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (CommandException& e)
+			{
+				Assert::AreEqual("Unknown option: --unknown", e.what());
+			}
+		}
+
+		TEST_METHOD(testVerifyAllAreTakenThrowsExceptionForAnUnknownOption)
+		{
+			Words words = { "g", "--unknown=1" };
+			CommandArguments arguments(words);
+			arguments.takeArgument("graph");
+
+			try
+			{
+				arguments.verifyAllAreTaken();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (CommandException& e)
+			{
+				Assert::AreEqual("Unknown option: --unknown=1", e.what());
+			}
+		}
+
+		TEST_METHOD(testVerifyAllAreTakenThrowsExceptionForAnExtraArgument)
+		{
+			Words words = { "g", "extra" };
+			CommandArguments arguments(words);
+			arguments.takeArgument("graph");
+
+			try
+			{
+				arguments.verifyAllAreTaken();
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (CommandException& e)
+			{
+				Assert::AreEqual("Unexpected argument: extra", e.what());
+			}
+		}
+
+		TEST_METHOD(testTakeArgumentThrowsExceptionIfTheArgumentIsMissing)
+		{
+			Words words;
+			CommandArguments arguments(words);
+
+			try
+			{
+				arguments.takeArgument("graph");
+				Assert::Fail(L"The method did not throw an exception!");
+			}
+			catch (MissingArgumentException& e)
+			{
+				Assert::AreEqual("Missing argument: [graph]!", e.what());
+			}
+		}
+
+		TEST_METHOD(testTakeNumber)
+		{
+			Words words = { "42" };
+			CommandArguments arguments(words);
+
+			Assert::AreEqual(42, arguments.takeNumber<int>("weight"));
+			Assert::IsFalse(arguments.hasArgument());
+		}
+	};
+}
\ No newline at end of file
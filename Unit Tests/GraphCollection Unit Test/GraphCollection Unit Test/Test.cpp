@@ -129,6 +129,28 @@ namespace GraphCollectionUnitTest
 			}
 		}
 
+		TEST_METHOD(testGetUnloadedBuildsACopyAndLeavesTheGraphUnloaded)
+		{
+			String id = "g";
+			GraphCollection graphs;
+			graphs.addUnloaded(id, [id]() { return makeGraph(id); });
+
+			GraphCollection::GraphPointer copy = graphs.getUnloaded(id);
+
+			Assert::IsTrue(copy != nullptr);
+			Assert::IsTrue(copy->getID() == id);
+			Assert::IsFalse(graphs.isLoaded(id));
+		}
+
+		TEST_METHOD(testGetUnloadedReturnsNullptrForALoadedGraph)
+		{
+			String id = "g";
+			GraphCollection graphs =
+				makeCollectionContainingGraphWithID(id);
+
+			Assert::IsTrue(graphs.getUnloaded(id) == nullptr);
+		}
+
 		TEST_METHOD(testEmpty)
 		{
 			GraphCollection graphs =
@@ -7,7 +7,7 @@ namespace StringCutterUnitTest
 {		
 	TEST_CLASS(StringCutterTest)
 	{
-		using StringList = std::vector<std::string>;
+		using StringList = std::vector<std::string_view>;
 
 		static bool areEqual(const char* lhs, const char* rhs)
 		{
@@ -25,7 +25,7 @@ namespace StringCutterUnitTest
 
 			for (size_t i = 0; i < expectedSize; ++i)
 			{
-				if (!areEqual(expected[i], actual[i].c_str()))
+				if (actual[i] != expected[i])
 				{
 					return false;
 				}
@@ -39,8 +39,9 @@ namespace StringCutterUnitTest
 		{
 			StringCutter cutter;
 			char sentence[] = " \'two\' \"words\"";
+			StringList words;
 
-			StringList words = cutter.cutToWords(sentence);
+			cutter.cutToWords(sentence, words);
 
 			size_t expectedSize = 2;
 			const char* expected[] = { "\'two\'", "\"words\"" };
@@ -51,8 +52,9 @@ namespace StringCutterUnitTest
 		{
 			StringCutter cutter({ '\'', '\"' });
 			char sentence[] = "\'first word\' \"second word\"";
+			StringList words;
 
-			StringList words = cutter.cutToWords(sentence);
+			cutter.cutToWords(sentence, words);
 
 			size_t expectedSize = 2;
 			const char* expected[] = { "first word", "second word" };
@@ -63,8 +65,9 @@ namespace StringCutterUnitTest
 		{
 			StringCutter cutter({ '\'' });
 			char sentence[] = " first \'long word\'";
+			StringList words;
 
-			StringList words = cutter.cutToWords(sentence);
+			cutter.cutToWords(sentence, words);
 
 			size_t expectedSize = 2;
 			const char* expected[] = { "first", "long word" };
@@ -75,10 +78,11 @@ namespace StringCutterUnitTest
 		{
 			StringCutter cutter({ '\"', '\'' });
 			char sentence[] = "\"different word delimiters\'";
+			StringList words;
 
 			try
 			{
-				cutter.cutToWords(sentence);
+				cutter.cutToWords(sentence, words);
 				Assert::Fail(L"The method did not throw an exception!");
 			}
 			catch (std::logic_error& e)
@@ -92,10 +96,11 @@ namespace StringCutterUnitTest
 		{
 			StringCutter cutter({ '\"' });
 			char sentence[] = "\"missing delimiter";
+			StringList words;
 
 			try
 			{
-				cutter.cutToWords(sentence);
+				cutter.cutToWords(sentence, words);
 				Assert::Fail(L"The method did not throw an exception!");
 			}
 			catch (std::logic_error& e)
@@ -105,24 +110,38 @@ namespace StringCutterUnitTest
 			}
 		}
 
-		TEST_METHOD(testCutToWordsReturnsEmptyStringIfPassedAStringOfIntervals)
+		TEST_METHOD(testCutToWordsFindsNoWordsInAStringOfIntervals)
 		{
 			StringCutter cutter;
 			char intervals[] = "   ";
+			StringList words = { "stale" };
 
-			StringList words = cutter.cutToWords(intervals);
+			cutter.cutToWords(intervals, words);
 
-			size_t expectedSize = 1;
-			const char* expected[] = { "" };
-			Assert::IsTrue(wordsMatch(expected, words, expectedSize));
+			Assert::IsTrue(words.empty());
+		}
+
+		TEST_METHOD(testCutToWordsReturnsViewsIntoTheCutString)
+		{
+			StringCutter cutter({ '\'' });
+			char sentence[] = "first \'second word\'";
+			StringList words;
+
+			cutter.cutToWords(sentence, words);
+
+			Assert::IsTrue(words.size() == 2);
+			Assert::IsTrue(words[0].data() == sentence);
+			Assert::IsTrue(words[1].data() == sentence + 7);
+			Assert::IsTrue(areEqual("first", sentence));
 		}
 
 		TEST_METHOD(testCutToWordsIgnoresSpacesAfterTheLastWord)
 		{
 			StringCutter cutter;
 			char sentence[] = "first second    ";
+			StringList words;
 
-			StringList words = cutter.cutToWords(sentence);
+			cutter.cutToWords(sentence, words);
 
 			size_t expectedSize = 2;
 			const char* expected[] = { "first", "second" };